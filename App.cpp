@@ -1,603 +1,1314 @@
-#include <Arduino.h>
-#include "Config.h"
-#include "LCD.h"
-#include "Slides.h"
-#include "App.h"
-
-// data: see resources sub-directory:
-#include "GraphicsData.h"
-#include "FontData.h"
-
-// the rounded corners, made by hand, 5x5
-#define ROUND_CORNER_SIZE 5
-static const uint8_t TopLeft[] PROGMEM =
-{
-  0,0, 0,0, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0b00000111,
-  0b00011111,
-  0b00111111,
-  0b01111111,
-  0b01111111,
-};
-
-static const uint8_t TopRight[] PROGMEM =
-{
-  1,219, 0,0, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0b00000000,
-  0b11000000,
-  0b11100000,
-  0b11110000,
-  0b11110000,
-};
-
-static const uint8_t BottomLeft[] PROGMEM =
-{
-  0,0, 1,59, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0b00101000,
-  0b01010000,
-  0b00101000,
-  0b00010000,
-  0b00000000,
-};
-
-// Note the bottom-right corner looks a bit less rounded because of the way
-// it combines with the checkerboard pattern.
-static const uint8_t BottomRight[] PROGMEM =
-{
-  1,219, 1,59, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0b01010000,
-  0b10100000,
-  0b01000000,
-  0b10000000,
-  0b00000000,
-};
-
-// multiple strings in a single PROGMEM string
-#undef MSTR
-#define MSTR(_s) _s "\0"
-
-namespace App
-{
-  // The app menu (\x80=<apple>)
-  static const char pMenu[] PROGMEM = MSTR("\x80") MSTR("File") MSTR("Edit") MSTR("Goodies") MSTR("Font") MSTR("FontSize") MSTR("Style");
-  // Splash text (\x7F=<bullet>, \x81=<command>)
-  static const char pSplash[] PROGMEM = "\x81 LackPaint \x80 Mark Wilson \x7F MMXXV \x81";
-  // Default image name
-  static const char pUntitled[] PROGMEM = "untitled";
-  // Messages
-  static const char pPausedMsg[] PROGMEM = "Paused";
-  static const char pSeedMsg[] PROGMEM = "Randomized";
-  // Help
-  static const char pHelp[] PROGMEM = "Tap image to pause/resume."
-  #ifdef CFG_RANDOM_ORDER
-    " Elsewhere to randomize."
-  #endif
-  ;
-  
-  bool paused = false;
-  bool getNextSlide = false;
-  
-  void DrawOneBPPData(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* pData, bool white1, uint16_t size = 1, bool compressed = true)
-  {
-    // draw 1BPP data from pData into x, y, w, h. if white1, 1's are white, else black
-    // fill sigle pixels if size=1, else blocks
-    const byte* prevFullRows[BMP_ROW_ESC_IDX + 1]; // record ptrs to the most recent 8 (lower 8) full rows and the first 8 full rows (upper 8)
-    byte recentFullRowsIdx = 0;
-    byte initialFullRowsIdx = BMP_ROW_ESC_IDX_BLACK;
-    prevFullRows[initialFullRowsIdx++] = NULL; // black row
-    if (size == 1)
-      LCD_BEGIN_FILL(x, y, w, h);
-    for (uint16_t row = 0; row < h; row++)
-    {
-      const uint8_t* pRow = NULL;
-      // there is some simple compression, 1-byte escape values indicating a duplicate row
-      uint8_t firstByte = pgm_read_byte(pData);
-      if (compressed && (firstByte & BMP_ROW_ESC_MASK) == BMP_ROW_ESC_VALUE)
-      {
-        // add escaped row
-        pRow = prevFullRows[firstByte & BMP_ROW_ESC_IDX];
-        if (!pRow)
-          LCD_FILL_COLOUR(size * w, LCD_BLACK); // all black
-        // repaint a previous row
-        pData++; // just one byte in row
-      }
-      else
-      {
-        // add a new full row
-        pRow = pData;
-        // update initial and recent full row ptrs
-        if (initialFullRowsIdx <= BMP_ROW_ESC_IDX)
-          prevFullRows[initialFullRowsIdx++] = pRow;
-        prevFullRows[recentFullRowsIdx++] = pRow;
-        if (recentFullRowsIdx >= BMP_ROW_ESC_IDX_BLACK) // wrap recent rows
-          recentFullRowsIdx = 0;
-        pData = NULL; // update pData with pRow
-      }
-      if (pRow)
-      {
-        uint8_t Mask = 0x80;
-        uint8_t Byte = pgm_read_byte(pRow++);
-        for (uint16_t col = 0; col < w; col++)
-        {
-          if (size == 1)
-          {
-            if ((bool)(Byte & Mask) == white1) // a 1 == white
-              LCD_ONE_WHITE();
-            else
-              LCD_ONE_BLACK();
-          }
-          else
-          {
-            if ((bool)(Byte & Mask) != white1) // only draw black (white backgound)
-              LCD_FILL_RECT(x + col*size, y + row*size, size, size, LCD_BLACK);
-          }
-          Mask >>= 1;
-          if (!Mask && (col < (w - 1))) // next byte in row
-          {
-            Mask = 0x80;
-            Byte = pgm_read_byte(pRow++);
-          }
-        }
-        if (!pData)
-          pData = pRow;
-      }
-    }
-  }
-  
-  int8_t SignedNibble(uint8_t value)
-  {
-    // convert 0bsxxx to signed value s=1 is -ve
-    if (value & 0x08)
-      return -(int8_t)(value & 0x07);
-    else
-      return  (int8_t)(value & 0x07);
-  }
-  
-  void DrawChar(uint8_t ch, uint16_t& x, uint16_t y, bool draw)
-  {
-    // draw char with baseline at x, y. advances x
-    if (ch == ' ')
-    {
-      x += 4;
-      return;
-    }
-    const uint8_t* pData = Font;
-    uint8_t def = 0;
-    int8_t w = 0, h = 0, dx = 0, dy = 0;
-    do
-    {
-      def = pgm_read_byte(pData++);
-      if (def)
-      {
-        uint8_t temp = pgm_read_byte(pData++);  // (w, h):0bwwwwhhhh, (dx, dy)
-        w = (int8_t)(temp >> 4);
-        h = (int8_t)(temp & 0x0F);
-        temp = pgm_read_byte(pData++);          // (dx, dy):0bsxxxsyyy s:sign, 1=-ve
-        dx = SignedNibble(temp >> 4);
-        dy = SignedNibble(temp & 0x0F);
-        if (def < ch)
-          pData += (w <= 8)?h:2*h;
-        else
-          break;
-      }
-    } while (def);
-    if (def == ch)
-    {
-      x += dx;
-      y += -dy - h + 1;
-      if (draw)
-        DrawOneBPPData(x, y, w, h, pData, false, 1, false);
-      x += w + 1;
-    }
-  }
-  
-  void DrawString(const char* str, uint16_t& x, uint16_t y, bool progmem)
-  {
-    // draw the string at x, y. advanced x. progmem or RAM
-    if (str)
-      while (progmem?pgm_read_byte(str):*str)
-        DrawChar(progmem?pgm_read_byte(str++):*str++, x, y, true);
-  }
-  
-  uint16_t PixelWidth(const char* str, bool progmem)
-  {
-    // return pixel width of string. progmem or RAM
-    uint16_t x = 0;
-    if (str)
-      while (progmem?pgm_read_byte(str):*str)
-        DrawChar(progmem?pgm_read_byte(str++):*str++, x, 0, false);
-    return x;
-  }
-  
-  uint16_t GetHiLo(const uint8_t*& pData)
-  {
-    // read Hi, Lo bytes from progmen, return word
-    uint16_t hi = pgm_read_byte(pData++)*256;
-    return hi + pgm_read_byte(pData++);
-  }
-
-  void DrawWindowData(const uint8_t* pData, bool compressed = true)
-  {
-    // draw the encoded data at pData (with or without compression)
-    uint16_t x = GetHiLo(pData);
-    uint16_t y = GetHiLo(pData);
-    uint16_t w = GetHiLo(pData);
-    uint16_t h = GetHiLo(pData);
-    DrawOneBPPData(x, y, w, h, pData, true, 1, compressed);
-  }
-  
-  void DrawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
-  {
-    // black rect x, y, w, h. 1 pixel lines
-    LCD_FILL_RECT(x, y, w, 1, LCD_BLACK);         // top
-    LCD_FILL_RECT(x, y, 1, h, LCD_BLACK);         // left
-    LCD_FILL_RECT(x + w - 1, y, 1, h, LCD_BLACK); // right
-    LCD_FILL_RECT(x, y + h - 1, w, 1, LCD_BLACK); // bottom
-  }
-  
-  void DrawWindowFrame(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
-  {
-    // x, y, w, h are of window interior
-    w += 2;
-    h += 2;
-    DrawRect(--x, --y, w, h);
-    // drop shadow
-    LCD_FILL_RECT(x + w, y, 1, h + 1, LCD_BLACK); // right
-    LCD_FILL_RECT(x, y + h, w + 1, 1, LCD_BLACK); // bottom
-  }
-  
-  void DrawImageTitleBarBands(uint16_t x, uint16_t y, uint16_t h, uint16_t len)
-  {
-    // Draw the banded part of the title bar
-    LCD_FILL_RECT(x, y, len, 3, LCD_WHITE); // upper gap
-    for (int bar = 0; bar < 6; bar++) // bands
-    {
-      LCD_FILL_RECT(x, y + 3 + 2 * bar, len, 1, LCD_BLACK);
-      LCD_FILL_RECT(x, y + 4 + 2 * bar, len, 1, LCD_WHITE);
-    }
-    LCD_FILL_RECT(x, y + h - 2, len, 2, LCD_WHITE); // lower gap
-  }
-  
-  void DrawImageTitleBar(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
-  {
-    // Initial draw of blank titlebar
-    DrawImageTitleBarBands(x + 1, y, h, w - 2);
-    LCD_FILL_RECT(x, y + h, w, 1, LCD_BLACK); // bottom line
-    // Square on LHS
-    LCD_FILL_RECT(x + 7, y + 3, 13, 11, LCD_WHITE);
-    DrawRect(x + 8, y + 3, 11, 11);
-  }
-  
-  void DrawImageTitleText(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char* pStr, bool progmem)
-  {
-    // Update the text on the title bar
-    const uint16_t kBandsLHS = 20;
-    const uint16_t kBandsRHS = 2;
-    if (pStr)
-    {
-      // allow a title bar with no title
-      const uint16_t gap = 6;
-      uint16_t len = PixelWidth(pStr, progmem);
-      uint16_t cenX = x + (w - len) / 2;
-      uint16_t bandX = x + kBandsLHS;
-      DrawImageTitleBarBands(bandX, y, h, cenX - gap - bandX); // LHS to text
-      bandX = cenX - gap + len + 2*gap;
-      DrawImageTitleBarBands(bandX, y, h, x + w - kBandsRHS - bandX); // text to RHS
-      LCD_FILL_RECT(cenX - gap, y + 1, len + 2*gap, h - 2, LCD_WHITE);
-      DrawString(pStr, cenX, y + FONT_HEIGHT, progmem);
-    }
-    else // blank
-      DrawImageTitleBarBands(x + kBandsLHS, y, h, w - kBandsRHS - kBandsLHS);
-  }
-
-  #define MENU_TEXT_Y 13
-  #define MENU_ITEM_GAP 13
-  #define MENU_BAR_HEIGHT 19
-  void DrawMenuMessage(const char* pMsg, bool draw)
-  {
-    // draw/clear msg on far right of menu bar
-    int w = PixelWidth(pMsg, true);
-    uint16_t x = LCD_WIDTH - w - ROUND_CORNER_SIZE;
-    if (draw)
-      DrawString(pMsg, x, MENU_TEXT_Y, true);
-    else
-      LCD_FILL_RECT(x, 0, w, MENU_BAR_HEIGHT - 1, LCD_WHITE);
-  }
-  
-  void DrawMenuItems()
-  {
-    // draw the menu text items, apple, File etc
-    const char* pStr = pMenu;
-    uint16_t x = 12;
-    while (pgm_read_byte(pStr))
-    {
-      DrawString(pStr, x, MENU_TEXT_Y, true);
-      x += MENU_ITEM_GAP;
-      pStr += strlen_P(pStr) + 1;
-    }    
-  }
-
-  void DrawLines()
-  {
-    // Draw the palette of line types. Done in code vs window data, saves ~90 bytes code space
-    const int kLinesX = 26;
-    const int kLinesY = 248;
-    const int kLinesW = 29;
-    const int kLinesGap = 9; // whitespace between lines (first gap is 10)
-    int y = kLinesY;
-    int h = 1;
-    LCD_BEGIN_FILL(kLinesX, y, kLinesW, h);
-    for (uint16_t x = 0; x < kLinesW; x++)
-      if (x & 0b11)
-        LCD_ONE_WHITE();
-      else
-        LCD_ONE_BLACK();
-    y++;
-    for (int line = 0; line < 4; line++)
-    {
-      y += kLinesGap + h;
-      h = 1 << line;
-      LCD_FILL_RECT(kLinesX, y, kLinesW, h, LCD_BLACK);
-    }
-  }
-  
-  // constants are for INSIDE of window...
-  // drawing window
-  const uint16_t kDrawWindowX = 74;
-  const uint16_t kDrawWindowY = 30;
-  const uint16_t kDrawWindowW = 396;
-  const uint16_t kDrawWindowH = 236;
-  const uint16_t kDrawWindowTitleH = 17;
-  const uint16_t kDrawWindowImageW = kDrawWindowW; // 396 pixels wide
-  const uint16_t kDrawWindowImageH = kDrawWindowH - kDrawWindowTitleH - 1; // 218 pixels high
-
-  // timing of slides:
-  uint32_t LastImageAtMS = 0;
-  uint32_t TimeToNextImageMS = 0;
-  
-  void DrawSplash(bool draw)
-  {
-#ifdef CFG_FULL_SPLASH    
-    // draw (or clear) the icon centred and enlarged, and help line
-    const int kIconSize = 32;
-    const int kCellSize = 3;
-    uint16_t x = kDrawWindowX + (kDrawWindowImageW - kIconSize*kCellSize)/2;
-    uint16_t y = kDrawWindowY + kDrawWindowTitleH + (kDrawWindowImageH - kIconSize*kCellSize)/2;
-    if (draw)
-      DrawOneBPPData(x, y, kIconSize, kIconSize, pIconImage, false, kCellSize);
-    else
-      LCD_FILL_RECT(x, y, kIconSize*kCellSize, kIconSize*kCellSize, LCD_WHITE);
-      
-    uint16_t w = PixelWidth(pHelp, true);
-    x = kDrawWindowX + (kDrawWindowW - w)/2;
-    y = kDrawWindowY + kDrawWindowH - FONT_DESCENDER - 2; 
-    if (draw)
-      DrawString(pHelp, x, y, true);    
-    else
-      LCD_FILL_RECT(x, y - FONT_HEIGHT, w, FONT_HEIGHT + FONT_DESCENDER + 1, LCD_WHITE); 
-#else
-    (void)draw;
-#endif  
-  }
-
-  void DrawBusy(bool draw, bool disk = false)
-  {
-    // draw/clear the busy "watch" or disk cursor/icon
-#ifdef CFG_SHOW_BUSY_ICONS    
-    const int kBusySize = 16;
-    uint16_t x = LCD_WIDTH - kBusySize - ROUND_CORNER_SIZE;
-    uint16_t y = (MENU_BAR_HEIGHT - kBusySize)/2;
-    if (draw)
-      DrawOneBPPData(x, y, kBusySize, kBusySize,disk?pDiskImage:pBusyImage, false);
-    else
-      LCD_FILL_RECT(x, y, kBusySize, kBusySize, LCD_WHITE);
-#else
-    (void)draw;
-    (void)disk;
-#endif      
-  }
-
-  #define TOUCH_SAMPLE_COUNT_SHIFT 3 // 8 samples
-  #define TOUCH_SAMPLE_COUNT (1 << TOUCH_SAMPLE_COUNT_SHIFT)
-  byte _xSamples[TOUCH_SAMPLE_COUNT];
-  byte _ySamples[TOUCH_SAMPLE_COUNT];
-  byte _sampleCount = 0;
-  byte _sampleIdx = 0;
-  
-  int Average(byte* pSamples)
-  {
-    // return the average sample, TIMES TWO
-    int sum = 0;
-    for (int i = 0; i < TOUCH_SAMPLE_COUNT; i++)
-      sum += *pSamples++;
-    return sum >> (TOUCH_SAMPLE_COUNT_SHIFT - 1);
-  }
-  
-  bool GetStableTouch(int& touchX, int& touchY)
-  {
-    // true if there's a touch. averaged position (seems quite noisy)
-    // From AMeagreBall where RAM was tight, hence the byte-sized things
-    if (LCD_GET_TOUCH(touchX, touchY))
-    {
-      // discard LSB so they fit in a byte (HALVED)
-      touchX >>= 1;
-      touchY >>= 1;
-      if (_sampleCount == TOUCH_SAMPLE_COUNT)
-      {
-        _xSamples[_sampleIdx] = touchX;
-        _ySamples[_sampleIdx] = touchY;
-        _sampleIdx++;
-        if (_sampleIdx >= TOUCH_SAMPLE_COUNT)
-          _sampleIdx = 0;
-        touchX = Average(_xSamples);
-        touchY = Average(_ySamples);
-        _sampleCount = _sampleIdx = 0; // reset
-        return true;
-      }
-      else
-      {
-        // just add the samples
-        _xSamples[_sampleIdx] = touchX;
-        _ySamples[_sampleIdx] = touchY;
-        _sampleCount = ++_sampleIdx;
-        return false;
-      }
-    }
-    else
-    {
-      _sampleCount = _sampleIdx = 0;
-      return false;
-    }
-  }
-  
-  void Init()
-  {
-    // draw the entire screen...
-    
-    // fill with alternating white/black pixels
-    SERIALISE_ON(false);
-    LCD_BEGIN_FILL(0, 0, LCD_WIDTH, LCD_HEIGHT);
-    for (uint16_t row = 0; row < LCD_HEIGHT; row++)
-      for (uint16_t col = 0; col < LCD_WIDTH; col++)
-        if ((col + (row & 0x0001)) & 0x0001)
-          LCD_ONE_WHITE();
-        else
-          LCD_ONE_BLACK();    
-
-    // if serializing the screen, add the alternating pixels as a short-cut command
-    SERIALISE_ON(true);
-#ifdef SERIALIZE
-    Serial.println("!"); // serialize short-cut:fill with alt pix!
-#endif      
-        
-    // menu bar
-    LCD_FILL_RECT(0, 0, LCD_WIDTH, MENU_BAR_HEIGHT, LCD_WHITE);
-    LCD_FILL_RECT(0, MENU_BAR_HEIGHT, LCD_WIDTH, 1, LCD_BLACK);
-
-    DrawWindowFrame(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowH);
-    LCD_FILL_RECT(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowH, LCD_WHITE);
-  
-    // drawing window title bar
-    DrawImageTitleBar(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH);
-#ifdef DEBUG
-    DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pUntitled, true);
-    DrawMenuItems();
-#else
-    // if splash, no main menu
-    DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pSplash, true);
-    DrawSplash(true);
-#endif    
-    
-    // tools window
-    const uint16_t kToolWindowX = 10;
-    const uint16_t kToolWindowY = 29;
-    const uint16_t kToolWindowW = 51;
-    const uint16_t kToolWindowH = 197;
-    DrawWindowFrame(kToolWindowX, kToolWindowY, kToolWindowW, kToolWindowH);
-    DrawWindowData(pToolsData);
-  
-    // line window
-    const uint16_t kLineWindowX = 10;
-    const uint16_t kLineWindowY = 237;
-    const uint16_t kLineWindowW = 51;
-    const uint16_t kLineWindowH = 75;
-    DrawWindowFrame(kLineWindowX, kLineWindowY, kLineWindowW, kLineWindowH);
-    LCD_FILL_RECT(kLineWindowX, kLineWindowY, kLineWindowW, kLineWindowH, LCD_WHITE);
-    DrawWindowData(pTickData);
-    DrawLines();
-  
-    // fill window
-    const uint16_t kFillWindowX = 72;
-    const uint16_t kFillWindowY = 279;
-    const uint16_t kFillWindowW = 401;
-    const uint16_t kFillWindowH = 33;
-    DrawWindowFrame(kFillWindowX, kFillWindowY, kFillWindowW, kFillWindowH);
-    DrawWindowData(pFillsData);
-  
-    // rounded corners
-    DrawWindowData(TopLeft, false);
-    DrawWindowData(TopRight, false);
-    DrawWindowData(BottomLeft, false);
-    DrawWindowData(BottomRight, false);
-    
-#ifndef DEBUG
-    delay(5000);  // dwell on splash
-    // if splash, draw main menu
-    DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pUntitled, true);
-    DrawMenuItems();
-    DrawSplash(false);
-#endif
-
-    DrawBusy(true, true);
-    Slides::GetFirst();
-    DrawBusy(false);
-    getNextSlide = false;
-    LastImageAtMS = millis();
-    TimeToNextImageMS = 2000UL; // blank at the start
-  }
-
-  void Loop()
-  {
-    // called on main loop, checks if it's time for the next slide
-    uint32_t NowMS = millis();
-    if (!paused && (NowMS - LastImageAtMS) >= TimeToNextImageMS)
-    {
-      // next slide
-      // scanning the dir may take a long time, show the busy cursor
-      DrawBusy(true, true);
-      if (getNextSlide)
-        Slides::GetNext();
-      getNextSlide = true;
-      char pFileName[SLIDE_APPENDED_TEXT_MAX_LEN + 1];
-      DrawBusy(true);
-      DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, NULL, false); // no title while drawing
-      bool painted = Slides::PaintCurrent(kDrawWindowX, kDrawWindowY + kDrawWindowTitleH + 1, kDrawWindowImageW, kDrawWindowImageH, pFileName);
-      bool haveName = strlen(pFileName);
-      if (haveName)
-        DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pFileName, false);
-      DrawBusy(false);
-      LastImageAtMS = millis();
-      if (painted)
-        TimeToNextImageMS = CFG_SECONDS_BETWEEN_IMAGES;
-      else
-        TimeToNextImageMS = haveName?1:0; // go to next quickly. Flash bad file name
-      TimeToNextImageMS *= 1000UL;
-    }
-#ifdef CFG_LCD_HAS_TOUCH    
-    else
-    {
-      int x, y;
-      if (GetStableTouch(x, y))
-      {
-        int x1, y1;
-        while (LCD_GET_TOUCH(x1, y1)) // wait for up
-          ;
-#ifdef CFG_SHOW_TOUCH          
-        LCD_FILL_RECT(x - 3, y, 7, 1, RGB(255,0,0));
-        LCD_FILL_RECT(x, y - 3, 1, 7, RGB(255,0,0));
-#endif        
-        if ((int)kDrawWindowX <= x && x <= (int)(kDrawWindowX + kDrawWindowW) &&
-            (int)kDrawWindowY <= y && y <= (int)(kDrawWindowY + kDrawWindowH))
-        {
-          // touch in image window, pause/resume
-          paused = !paused;
-          DrawMenuMessage(pPausedMsg, paused);
-        }
-        else if (!paused)
-        {
-          // touch elsewhere, randomize. 
-          // PRNG is seeded from millis(), touch position and current image file name.
-          DrawMenuMessage(pSeedMsg, true);
-          uint32_t seed = x*y; 
-          seed += millis();
-          seed ^= Slides::NameAsSeed();
-          randomSeed(seed);
-          delay(1000); // show msg briefly
-          DrawMenuMessage(pSeedMsg, false);
-        }
-      }
-    }
-#endif    
-  }
-  
-}
+#include <Arduino.h>
+#include "Config.h"
+#include "LCD.h"
+#include "Slides.h"
+#include "Ingest.h"
+#include "Tasks.h"
+#include "Power.h"
+#include "Stats.h"
+#include "Memory.h"
+#include "Scratch.h"
+#include "App.h"
+
+// data: see resources sub-directory:
+#include "GraphicsData.h"
+#include "FontData.h"
+
+// the rounded corners, made by hand, 5x5
+#define ROUND_CORNER_SIZE 5
+static const uint8_t TopLeft[] PROGMEM =
+{
+  0,0, 0,0, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0b00000111,
+  0b00011111,
+  0b00111111,
+  0b01111111,
+  0b01111111,
+};
+
+static const uint8_t TopRight[] PROGMEM =
+{
+  1,219, 0,0, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0b00000000,
+  0b11000000,
+  0b11100000,
+  0b11110000,
+  0b11110000,
+};
+
+static const uint8_t BottomLeft[] PROGMEM =
+{
+  0,0, 1,59, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0b00101000,
+  0b01010000,
+  0b00101000,
+  0b00010000,
+  0b00000000,
+};
+
+// Note the bottom-right corner looks a bit less rounded because of the way
+// it combines with the checkerboard pattern.
+static const uint8_t BottomRight[] PROGMEM =
+{
+  1,219, 1,59, 0,5, 0,5,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0b01010000,
+  0b10100000,
+  0b01000000,
+  0b10000000,
+  0b00000000,
+};
+
+// multiple strings in a single PROGMEM string
+#undef MSTR
+#define MSTR(_s) _s "\0"
+
+namespace App
+{
+  // The app menu (\x80=<apple>)
+  static const char pMenu[] PROGMEM = MSTR("\x80") MSTR("File") MSTR("Edit") MSTR("Goodies") MSTR("Font") MSTR("FontSize") MSTR("Style");
+  // Splash text (\x7F=<bullet>, \x81=<command>)
+  static const char pSplash[] PROGMEM = "\x81 LackPaint \x80 Mark Wilson \x7F MMXXV \x81";
+  // Default image name
+  static const char pUntitled[] PROGMEM = "untitled";
+  // Messages
+  static const char pPausedMsg[] PROGMEM = "Paused";
+  static const char pSeedMsg[] PROGMEM = "Randomized";
+  // Help
+  static const char pHelp[] PROGMEM = "Tap image to pause/resume."
+  #ifdef CFG_THUMBNAIL_FOLDER
+    " Tools to browse."
+  #endif
+  #ifdef CFG_RANDOM_ORDER
+    " Elsewhere to randomize."
+  #endif
+  ;
+  
+  bool paused = false;
+  bool getNextSlide = false;
+  
+  // pixels of one colour, coalesced into runs before they go to the LCD window
+  uint16_t runLength = 0;
+  uint16_t runRoom = 0; // pixels left in the window's row, the rest are clipped
+  uint16_t runSkip = 0; // pixels to clip before the window's row
+  bool runBlack = false;
+  // or if transparent, the black runs are filled at runX, runY, runH high, and the white skipped
+  bool runTransparent = false;
+  uint16_t runX = 0;
+  uint16_t runY = 0;
+  uint16_t runH = 0;
+
+  void RunPush()
+  {
+    // push the run to the LCD
+    if (runTransparent)
+    {
+      if (runBlack && runLength)
+        LCD_FILL_RECT(runX, runY, runLength, runH, LCD_BLACK);
+      runX += runLength;
+    }
+    else if (runLength)
+      LCD_FILL_COLOUR(runLength, runBlack?LCD_BLACK:LCD_WHITE);
+    runLength = 0;
+  }
+
+  void RunPixels(uint16_t n, bool black)
+  {
+    // add n pixels to the run, pushing the run if the colour changes
+    if (runSkip)
+    {
+      // clipped on the left
+      uint16_t skip = (n < runSkip)?n:runSkip;
+      runSkip -= skip;
+      n -= skip;
+    }
+    if (n > runRoom)
+      n = runRoom;
+    if (!n)
+      return;
+    runRoom -= n;
+    if (black != runBlack)
+    {
+      RunPush();
+      runBlack = black;
+    }
+    runLength += n;
+  }
+
+  void EmitRow(const uint8_t* pRow, uint16_t w, bool white1, uint16_t size, bool progmem)
+  {
+    // emit a row of 1BPP data as runs, each pixel size wide
+    for (uint16_t bytes = (w + 7)/8; bytes; bytes--)
+    {
+      uint8_t Byte = progmem?pgm_read_byte(pRow):*pRow;
+      pRow++;
+      if (Byte == 0x00 || Byte == 0xFF) // all one colour, the partial byte at the end is clipped
+        RunPixels(8*size, (bool)Byte != white1);
+      else
+        for (uint8_t Mask = 0x80; Mask; Mask >>= 1)
+          RunPixels(size, (bool)(Byte & Mask) != white1);
+    }
+  }
+
+  // reading 1BPP data a row at a time
+  struct BitmapRows
+  {
+    const uint8_t* pData;
+    const byte* prevFullRows[BMP_ROW_ESC_IDX + 1]; // record ptrs to the most recent 8 (lower 8) full rows and the first 8 full rows (upper 8)
+    byte recentFullRowsIdx;
+    byte initialFullRowsIdx;
+  };
+
+  void BeginRows(BitmapRows& rows, const uint8_t* pData)
+  {
+    // start reading rows from pData
+    rows.pData = pData;
+    rows.recentFullRowsIdx = 0;
+    rows.initialFullRowsIdx = BMP_ROW_ESC_IDX_BLACK;
+    rows.prevFullRows[rows.initialFullRowsIdx++] = NULL; // black row
+  }
+
+  const uint8_t* NextRow(BitmapRows& rows, uint16_t w, bool compressed, bool progmem)
+  {
+    // return the next row w pixels wide, for EmitRow. NULL is all black
+    const uint8_t* pRow = rows.pData;
+    if (compressed)
+    {
+      // there is some simple compression, 1-byte escape values indicating a duplicate row
+      uint8_t firstByte = progmem?pgm_read_byte(pRow):*pRow;
+      if ((firstByte & BMP_ROW_ESC_MASK) == BMP_ROW_ESC_VALUE)
+      {
+        // repaint a previous row (NULL is all black)
+        rows.pData++; // just one byte in row
+        return rows.prevFullRows[firstByte & BMP_ROW_ESC_IDX];
+      }
+      // add a new full row
+      // update initial and recent full row ptrs
+      if (rows.initialFullRowsIdx <= BMP_ROW_ESC_IDX)
+        rows.prevFullRows[rows.initialFullRowsIdx++] = pRow;
+      rows.prevFullRows[rows.recentFullRowsIdx++] = pRow;
+      if (rows.recentFullRowsIdx >= BMP_ROW_ESC_IDX_BLACK) // wrap recent rows
+        rows.recentFullRowsIdx = 0;
+    }
+    rows.pData += (w + 7)/8;
+    return pRow;
+  }
+
+  void DrawOneBPPData(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* pData, bool white1, uint16_t size = 1, bool compressed = true, bool progmem = true, bool transparent = false)
+  {
+    // draw 1BPP data from pData (PROGMEM or RAM) into x, y, w, h. if white1, 1's are white, else black
+    // each pixel is size x size, in one window with each row repeated size times as runs of colour
+    // if transparent only the black is drawn, a fill per run, and what's under the white is left
+    BitmapRows rows;
+    BeginRows(rows, pData);
+    runTransparent = transparent;
+    runX = x;
+    runY = y;
+    runH = size;
+    if (!transparent)
+      LCD_BEGIN_FILL(x, y, w*size, h*size);
+    for (uint16_t row = 0; row < h; row++)
+    {
+      const uint8_t* pRow = NextRow(rows, w, compressed, progmem);
+      for (uint16_t rep = 0; rep < (transparent?1:size); rep++) // a transparent row's fills are size high
+      {
+        runRoom = w*size;
+        if (pRow)
+          EmitRow(pRow, w, white1, size, progmem);
+        else
+          RunPixels(w*size, true);
+        if (transparent)
+        {
+          // fill the row's last run, the next row's runs start at x
+          RunPush();
+          runX = x;
+          runY += size;
+        }
+      }
+    }
+    RunPush();
+    runTransparent = false;
+  }
+  
+  int8_t SignedNibble(uint8_t value)
+  {
+    // convert 0bsxxx to signed value s=1 is -ve
+    if (value & 0x08)
+      return -(int8_t)(value & 0x07);
+    else
+      return  (int8_t)(value & 0x07);
+  }
+  
+  void DrawChar(uint8_t ch, uint16_t& x, uint16_t y, bool draw)
+  {
+    // draw char with baseline at x, y. advances x
+    // the index tables find the glyph and its width directly
+    if (ch < FONT_FIRST_CHAR || ch > FONT_LAST_CHAR)
+      return;
+    ch -= FONT_FIRST_CHAR;
+    uint16_t offset = pgm_read_word(FontOffsets + ch);
+    if (draw && offset != FONT_NO_GLYPH)
+    {
+      const uint8_t* pData = Font + offset;
+      uint8_t temp = pgm_read_byte(pData++);  // (w, h):0bwwwwhhhh
+      int8_t w = (int8_t)(temp >> 4);
+      int8_t h = (int8_t)(temp & 0x0F);
+      temp = pgm_read_byte(pData++);          // (dx, dy):0bsxxxsyyy s:sign, 1=-ve
+      int8_t dx = SignedNibble(temp >> 4);
+      int8_t dy = SignedNibble(temp & 0x0F);
+      DrawOneBPPData(x + dx, y - dy - h + 1, w, h, pData, false, 1, false);
+    }
+    x += pgm_read_byte(FontAdvances + ch);
+  }
+  
+  void DrawString(const char* str, uint16_t& x, uint16_t y, bool progmem)
+  {
+    // draw the string at x, y. advanced x. progmem or RAM
+    if (str)
+      while (progmem?pgm_read_byte(str):*str)
+        DrawChar(progmem?pgm_read_byte(str++):*str++, x, y, true);
+  }
+  
+  uint16_t PixelWidth(const char* str, bool progmem)
+  {
+    // return pixel width of string. progmem or RAM
+    uint16_t x = 0;
+    if (str)
+      while (progmem?pgm_read_byte(str):*str)
+        DrawChar(progmem?pgm_read_byte(str++):*str++, x, 0, false);
+    return x;
+  }
+
+  void DrawTextLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h, int16_t textX, uint16_t baseline, const char* pStr, bool progmem)
+  {
+    // fill x, y, w, h white with the string drawn in it at textX, baseline (relative to x, y, textX -ve is clipped)
+    // a scanline at a time across all the glyphs, one window for the lot
+    LCD_BEGIN_FILL(x, y, w, h);
+    for (uint16_t row = 0; row < h; row++)
+    {
+      runRoom = w;
+      if (textX < 0)
+        runSkip = -textX;
+      else
+        RunPixels(textX, false);
+      const char* str = pStr;
+      while (progmem?pgm_read_byte(str):*str)
+      {
+        uint8_t ch = progmem?pgm_read_byte(str++):*str++;
+        if (ch < FONT_FIRST_CHAR || ch > FONT_LAST_CHAR)
+          continue;
+        ch -= FONT_FIRST_CHAR;
+        uint8_t advance = pgm_read_byte(FontAdvances + ch);
+        uint16_t offset = pgm_read_word(FontOffsets + ch);
+        if (offset != FONT_NO_GLYPH)
+        {
+          const uint8_t* pData = Font + offset;
+          uint8_t temp = pgm_read_byte(pData++);  // (w, h):0bwwwwhhhh
+          uint8_t gw = temp >> 4;
+          uint8_t gh = temp & 0x0F;
+          temp = pgm_read_byte(pData++);          // (dx, dy):0bsxxxsyyy s:sign, 1=-ve
+          int8_t dx = SignedNibble(temp >> 4);
+          int8_t dy = SignedNibble(temp & 0x0F);
+          int16_t glyphRow = row - (baseline - dy - gh + 1);
+          if (glyphRow >= 0 && glyphRow < gh)
+          {
+            // this scanline crosses the glyph, the rest of the advance is white
+            RunPixels(dx, false);
+            pData += glyphRow*((gw + 7)/8);
+            uint8_t Byte = 0;
+            for (uint8_t col = 0; col < gw; col++)
+            {
+              if (!(col & 7))
+                Byte = pgm_read_byte(pData++);
+              RunPixels(1, Byte & (0x80 >> (col & 7)));
+            }
+            advance -= dx + gw;
+          }
+        }
+        RunPixels(advance, false);
+      }
+      runSkip = 0;
+      RunPixels(runRoom, false);
+    }
+    RunPush();
+  }
+
+  uint16_t GetHiLo(const uint8_t*& pData)
+  {
+    // read Hi, Lo bytes from progmen, return word
+    uint16_t hi = pgm_read_byte(pData++)*256;
+    return hi + pgm_read_byte(pData++);
+  }
+
+  void DrawRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+  {
+    // black rect x, y, w, h. 1 pixel lines
+    LCD_FILL_RECT(x, y, w, 1, LCD_BLACK);         // top
+    LCD_FILL_RECT(x, y, 1, h, LCD_BLACK);         // left
+    LCD_FILL_RECT(x + w - 1, y, 1, h, LCD_BLACK); // right
+    LCD_FILL_RECT(x, y + h - 1, w, 1, LCD_BLACK); // bottom
+  }
+  
+  void DrawImageTitleBarBands(uint16_t x, uint16_t y, uint16_t h, uint16_t len)
+  {
+    // Draw the banded part of the title bar
+    LCD_FILL_RECT(x, y, len, 3, LCD_WHITE); // upper gap
+    for (int bar = 0; bar < 6; bar++) // bands
+    {
+      LCD_FILL_RECT(x, y + 3 + 2 * bar, len, 1, LCD_BLACK);
+      LCD_FILL_RECT(x, y + 4 + 2 * bar, len, 1, LCD_WHITE);
+    }
+    LCD_FILL_RECT(x, y + h - 2, len, 2, LCD_WHITE); // lower gap
+  }
+  
+  // the title bar's text box (titleLeft == titleRight if there's none) and its text, so updates only touch what changes
+  uint16_t titleLeft = 0;
+  uint16_t titleRight = 0;
+  char titleText[SLIDE_APPENDED_TEXT_MAX_LEN + 1] = "";
+  bool titleKnown = true; // false if the text was too long to keep
+
+  uint8_t CharAt(const char* pStr, uint8_t idx, bool progmem)
+  {
+    // the char at idx of the string. progmem or RAM
+    return progmem?pgm_read_byte(pStr + idx):pStr[idx];
+  }
+
+  void DrawImageTitleText(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char* pStr, bool progmem)
+  {
+    // Update the text on the title bar (NULL for none), only the columns that change
+    // bands where the old text box was and the new one isn't, then the new text box from the first to the last changed glyph
+    const uint16_t gap = 6;
+    uint16_t left = 0;
+    uint16_t right = 0;
+    uint8_t length = 0;
+    if (pStr)
+    {
+      uint16_t len = PixelWidth(pStr, progmem);
+      left = x + (w - len) / 2 - gap;
+      right = left + len + 2*gap;
+      length = progmem?strlen_P(pStr):strlen(pStr);
+    }
+    if (titleLeft < titleRight)
+    {
+      // bands over the old text box, what of it isn't the new one
+      if (left == right) // blank
+        DrawImageTitleBarBands(titleLeft, y, h, titleRight - titleLeft);
+      else
+      {
+        if (titleLeft < left)
+          DrawImageTitleBarBands(titleLeft, y, h, min(titleRight, left) - titleLeft); // LHS
+        if (titleRight > right)
+        {
+          uint16_t bandX = max(titleLeft, right);
+          DrawImageTitleBarBands(bandX, y, h, titleRight - bandX); // RHS
+        }
+      }
+    }
+    if (left < right)
+    {
+      // skip the glyphs that are unchanged, at the same place, from the left and then the right
+      uint8_t count = length;
+      uint8_t oldCount = strlen(titleText);
+      uint16_t changedLeft = left;
+      uint16_t changedRight = right;
+      uint8_t same = 0;
+      if (titleKnown && titleLeft == left)
+      {
+        changedLeft += gap;
+        while (same < count && same < oldCount && CharAt(pStr, same, progmem) == (uint8_t)titleText[same])
+          DrawChar(titleText[same++], changedLeft, 0, false);
+      }
+      if (titleKnown && titleRight == right)
+      {
+        changedRight -= gap;
+        while (count > same && oldCount > same && CharAt(pStr, count - 1, progmem) == (uint8_t)titleText[oldCount - 1])
+        {
+          uint16_t advance = 0;
+          DrawChar(titleText[--oldCount], advance, 0, false);
+          changedRight -= advance;
+          count--;
+        }
+      }
+      if (changedLeft < changedRight)
+        DrawTextLine(changedLeft, y + 1, changedRight - changedLeft, h - 2, left + gap - changedLeft, FONT_HEIGHT - 1, pStr, progmem); // text and its white surround
+    }
+    titleLeft = left;
+    titleRight = right;
+    titleKnown = length <= SLIDE_APPENDED_TEXT_MAX_LEN;
+    if (!pStr || !titleKnown)
+      *titleText = 0;
+    else if (progmem)
+      strcpy_P(titleText, pStr);
+    else
+      strcpy(titleText, pStr);
+  }
+
+  #define MENU_TEXT_Y 13
+  #define MENU_ITEM_GAP 13
+  #define MENU_BAR_HEIGHT 19
+  void DrawMenuMessage(const char* pMsg, bool draw)
+  {
+    // draw/clear msg on far right of menu bar
+    int w = PixelWidth(pMsg, true);
+    uint16_t x = LCD_WIDTH - w - ROUND_CORNER_SIZE;
+    if (draw)
+      DrawString(pMsg, x, MENU_TEXT_Y, true);
+    else
+      LCD_FILL_RECT(x, 0, w, MENU_BAR_HEIGHT - 1, LCD_WHITE);
+  }
+  
+  void DrawMenuItems()
+  {
+    // draw the menu text items, apple, File etc
+    const char* pStr = pMenu;
+    uint16_t x = 12;
+    while (pgm_read_byte(pStr))
+    {
+      DrawString(pStr, x, MENU_TEXT_Y, true);
+      x += MENU_ITEM_GAP;
+      pStr += strlen_P(pStr) + 1;
+    }    
+  }
+
+  // constants are for INSIDE of window...
+  // drawing window
+  const uint16_t kDrawWindowX = 74;
+  const uint16_t kDrawWindowY = 30;
+  const uint16_t kDrawWindowW = 396;
+  const uint16_t kDrawWindowH = 236;
+  const uint16_t kDrawWindowTitleH = 17;
+  const uint16_t kDrawWindowImageW = kDrawWindowW; // 396 pixels wide
+  const uint16_t kDrawWindowImageH = kDrawWindowH - kDrawWindowTitleH - 1; // 218 pixels high
+  // tools window
+  const uint16_t kToolWindowX = 10;
+  const uint16_t kToolWindowY = 29;
+  const uint16_t kToolWindowW = 51;
+  const uint16_t kToolWindowH = 197;
+  // fill window
+  const uint16_t kFillWindowX = 72;
+  const uint16_t kFillWindowY = 279;
+  const uint16_t kFillWindowW = 401;
+  const uint16_t kFillWindowH = 33;
+  // line window
+  const uint16_t kLineWindowX = 10;
+  const uint16_t kLineWindowY = 237;
+  const uint16_t kLineWindowW = 51;
+  const uint16_t kLineWindowH = 75;
+  // the palette of line types in it. Done as layers vs window data, saves ~90 bytes code space
+  const uint16_t kLinesX = 26;
+  const uint16_t kLinesW = 29;
+
+  // The static screen as layers, bottom up, composited a scanline at a time into one window (see Compose)
+  // LAYER_CHECKS, LAYER_DOTS and LAYER_BOX vary along a row, the others are one colour along it
+  enum { LAYER_CHECKS, LAYER_DOTS, LAYER_BOX, LAYER_BANDS, LAYER_WHITE, LAYER_BLACK, LAYER_FRAME, LAYER_BITMAP, LAYER_RAW_BITMAP };
+  struct Layer
+  {
+    uint8_t kind;
+    uint16_t x, y, w, h;  // bitmaps have theirs in pData
+    const uint8_t* pData;
+  };
+  static const Layer Layers[] PROGMEM =
+  {
+    { LAYER_CHECKS, 0, 0, LCD_WIDTH, LCD_HEIGHT, NULL },  // alternating white/black pixels
+    // menu bar
+    { LAYER_WHITE, 0, 0, LCD_WIDTH, MENU_BAR_HEIGHT, NULL },
+    { LAYER_BLACK, 0, MENU_BAR_HEIGHT, LCD_WIDTH, 1, NULL },
+    // drawing window, with a blank title bar and the square on its LHS
+    { LAYER_FRAME, kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowH, NULL },
+    { LAYER_WHITE, kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowH, NULL },
+    { LAYER_BANDS, kDrawWindowX + 1, kDrawWindowY, kDrawWindowW - 2, kDrawWindowTitleH, NULL },
+    { LAYER_BLACK, kDrawWindowX, kDrawWindowY + kDrawWindowTitleH, kDrawWindowW, 1, NULL },
+    { LAYER_WHITE, kDrawWindowX + 7, kDrawWindowY + 3, 13, 11, NULL },
+    { LAYER_BOX, kDrawWindowX + 8, kDrawWindowY + 3, 11, 11, NULL },
+    // tools window
+    { LAYER_FRAME, kToolWindowX, kToolWindowY, kToolWindowW, kToolWindowH, NULL },
+    { LAYER_BITMAP, 0, 0, 0, 0, pToolsData },
+    // line window, a dotted line and 1, 2, 4, 8 pixel lines
+    { LAYER_FRAME, kLineWindowX, kLineWindowY, kLineWindowW, kLineWindowH, NULL },
+    { LAYER_WHITE, kLineWindowX, kLineWindowY, kLineWindowW, kLineWindowH, NULL },
+    { LAYER_BITMAP, 0, 0, 0, 0, pTickData },
+    { LAYER_DOTS, kLinesX, 248, kLinesW, 1, NULL },
+    { LAYER_BLACK, kLinesX, 259, kLinesW, 1, NULL },
+    { LAYER_BLACK, kLinesX, 269, kLinesW, 2, NULL },
+    { LAYER_BLACK, kLinesX, 280, kLinesW, 4, NULL },
+    { LAYER_BLACK, kLinesX, 293, kLinesW, 8, NULL },
+    // fill window
+    { LAYER_FRAME, kFillWindowX, kFillWindowY, kFillWindowW, kFillWindowH, NULL },
+    { LAYER_BITMAP, 0, 0, 0, 0, pFillsData },
+    // rounded corners
+    { LAYER_RAW_BITMAP, 0, 0, 0, 0, TopLeft },
+    { LAYER_RAW_BITMAP, 0, 0, 0, 0, TopRight },
+    { LAYER_RAW_BITMAP, 0, 0, 0, 0, BottomLeft },
+    { LAYER_RAW_BITMAP, 0, 0, 0, 0, BottomRight },
+  };
+  const uint8_t kLayerCount = sizeof(Layers)/sizeof(Layers[0]);
+
+  uint8_t GetLayer(uint8_t idx, Layer& layer)
+  {
+    // get the layer and the rect it covers, return its kind
+    memcpy_P(&layer, Layers + idx, sizeof(Layer));
+    if (layer.kind >= LAYER_BITMAP)
+    {
+      // read the rect from the data
+      layer.x = GetHiLo(layer.pData);
+      layer.y = GetHiLo(layer.pData);
+      layer.w = GetHiLo(layer.pData);
+      layer.h = GetHiLo(layer.pData);
+    }
+    else if (layer.kind == LAYER_FRAME)
+    {
+      // x, y, w, h are of window interior, the frame is 1 pixel around it with a drop shadow
+      // it's black all over, the layers above cover the interior
+      layer.x--;
+      layer.y--;
+      layer.w += 3;
+      layer.h += 3;
+    }
+    return layer.kind;
+  }
+
+  void ComposeSpan(const Layer& layer, uint16_t row, uint16_t x, uint16_t end, const uint8_t* pBitmapRow)
+  {
+    // push the layer's pixels on row from x to end
+    uint16_t r = row - layer.y;
+    runRoom = end - x;
+    if (layer.kind >= LAYER_BITMAP)
+    {
+      // 1 is white, the compressed bitmap's row is pBitmapRow
+      if (layer.kind == LAYER_RAW_BITMAP)
+        pBitmapRow = layer.pData + r*((layer.w + 7)/8);
+      if (pBitmapRow)
+      {
+        runSkip = x - layer.x;
+        EmitRow(pBitmapRow, layer.w, true, 1, true);
+      }
+      else
+        RunPixels(end - x, true);
+    }
+    else if (layer.kind >= LAYER_BANDS)
+    {
+      // one colour along the row, the title bar bands are black on odd rows 3 to 13
+      bool black = (layer.kind == LAYER_BANDS)?((r & 1) && r >= 3 && r < 15):(layer.kind != LAYER_WHITE);
+      RunPixels(end - x, black);
+    }
+    else
+      for (uint16_t col = x; col < end; col++)
+      {
+        uint16_t c = col - layer.x;
+        if (layer.kind == LAYER_CHECKS)
+          RunPixels(1, !((col + row) & 1));
+        else if (layer.kind == LAYER_DOTS)
+          RunPixels(1, !(c & 0b11));
+        else // box, 1 pixel black lines around white
+          RunPixels(1, !r || r == layer.h - 1 || !c || c == layer.w - 1);
+      }
+  }
+
+  void Compose(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+  {
+    // draw x, y, w, h of the static screen, a scanline at a time in one window
+    // each pixel is written once, by the top layer there, as runs of colour
+    Layer layer;
+    uint8_t onRow[kLayerCount];  // layers on the scanline
+    BitmapRows rows;             // the compressed bitmap on the scanline, there's only ever one
+    const uint8_t* pBitmapRow = NULL;
+    LCD_BEGIN_FILL(x, y, w, h);
+    for (uint16_t row = y; row < y + h; row++)
+    {
+      uint8_t count = 0;
+      for (uint8_t idx = 0; idx < kLayerCount; idx++)
+      {
+        GetLayer(idx, layer);
+        if (row >= layer.y && row < layer.y + layer.h)
+        {
+          onRow[count++] = idx;
+          if (layer.kind == LAYER_BITMAP)
+          {
+            if (row == layer.y || row == y)
+            {
+              // starting the bitmap, or the rows above are clipped
+              BeginRows(rows, layer.pData);
+              for (uint16_t r = layer.y; r < row; r++)
+                NextRow(rows, layer.w, true, true);
+            }
+            pBitmapRow = NextRow(rows, layer.w, true, true);
+          }
+        }
+      }
+      // spans of the top layer at col, up to where it ends or a higher one starts
+      for (uint16_t col = x; col < x + w;)
+      {
+        uint16_t end = x + w;
+        uint8_t top = 0;
+        for (uint8_t idx = count; idx--;)
+        {
+          GetLayer(onRow[idx], layer);
+          if (col >= layer.x && col < layer.x + layer.w)
+          {
+            top = onRow[idx];
+            if (end > layer.x + layer.w)
+              end = layer.x + layer.w;
+            break;
+          }
+          if (layer.x > col && end > layer.x)
+            end = layer.x;
+        }
+        GetLayer(top, layer);
+        ComposeSpan(layer, row, col, end, pBitmapRow);
+        col = end;
+      }
+    }
+    RunPush();
+  }
+
+  // timing of slides:
+  uint32_t LastImageAtMS = 0;
+  uint32_t TimeToNextImageMS = 0;
+#ifdef CFG_CADENCE
+  // LastImageAtMS is never after now. A slide shown late (within the slack) is timed from when it was due,
+  // one shown early from when it was shown plus earlyMS, so the schedule doesn't drift
+  uint32_t earlyMS = 0;
+  uint32_t workEstimateMS = 0; // to find and paint a slide, a running average
+  uint16_t deadlineMisses = 0;
+
+  uint32_t NextDueMS()
+  {
+    // when the next slide should appear
+    return LastImageAtMS + earlyMS + TimeToNextImageMS;
+  }
+
+  void Cadence(uint32_t startMS, uint32_t dueMS, bool scheduled)
+  {
+    // learn from the slide started at startMS, to appear at dueMS, that has just appeared. Sets LastImageAtMS
+    uint32_t shownMS = millis();
+    uint32_t workMS = shownMS - startMS;
+    workEstimateMS = workEstimateMS?(3 * workEstimateMS + workMS) / 4:workMS;
+    int32_t lateMS = shownMS - dueMS;
+    earlyMS = 0;
+    if (scheduled && lateMS < 0)
+    {
+      // early, keep to the schedule without timing from the future
+      LastImageAtMS = shownMS;
+      earlyMS = -lateMS;
+    }
+    else if (!scheduled || lateMS > CFG_CADENCE)
+    {
+      // start a new schedule from now
+      LastImageAtMS = shownMS;
+      if (scheduled)
+      {
+        deadlineMisses++;
+#ifdef DEBUG
+        Serial.print(";deadline missed by ");Serial.print(lateMS);
+        Serial.print("ms, ");Serial.print(deadlineMisses);Serial.println(" misses");
+#endif
+      }
+    }
+    else
+      LastImageAtMS = dueMS;
+  }
+#endif
+  
+  void DrawSplash(bool draw)
+  {
+#ifdef CFG_FULL_SPLASH    
+    // draw (or clear) the icon centred and enlarged, and help line
+    const int kIconSize = 32;
+    const int kCellSize = 3;
+    uint16_t x = kDrawWindowX + (kDrawWindowImageW - kIconSize*kCellSize)/2;
+    uint16_t y = kDrawWindowY + kDrawWindowTitleH + (kDrawWindowImageH - kIconSize*kCellSize)/2;
+    if (draw)
+      DrawOneBPPData(x, y, kIconSize, kIconSize, pIconImage, false, kCellSize);
+    else
+      LCD_FILL_RECT(x, y, kIconSize*kCellSize, kIconSize*kCellSize, LCD_WHITE);
+      
+    uint16_t w = PixelWidth(pHelp, true);
+    x = kDrawWindowX + (kDrawWindowW - w)/2;
+    y = kDrawWindowY + kDrawWindowH - FONT_DESCENDER - 2; 
+    if (draw)
+      DrawString(pHelp, x, y, true);    
+    else
+      LCD_FILL_RECT(x, y - FONT_HEIGHT, w, FONT_HEIGHT + FONT_DESCENDER + 1, LCD_WHITE); 
+#else
+    (void)draw;
+#endif  
+  }
+
+  void DrawBusy(bool draw, bool disk = false)
+  {
+    // draw/clear the busy "watch" or disk cursor/icon
+#ifdef CFG_SHOW_BUSY_ICONS    
+    const int kBusySize = 16;
+    uint16_t x = LCD_WIDTH - kBusySize - ROUND_CORNER_SIZE;
+    uint16_t y = (MENU_BAR_HEIGHT - kBusySize)/2;
+    if (draw)
+      DrawOneBPPData(x, y, kBusySize, kBusySize,disk?pDiskImage:pBusyImage, false);
+    else
+      LCD_FILL_RECT(x, y, kBusySize, kBusySize, LCD_WHITE);
+#else
+    (void)draw;
+    (void)disk;
+#endif      
+  }
+
+#ifdef CFG_STATS
+  // the last slide's phase times are shown in place of the menu items, leaving the right for messages
+  const uint16_t kStatsX = 12;
+  const uint16_t kStatsW = LCD_WIDTH - 100 - kStatsX;
+  bool showStats = false;
+
+  void DrawStats(bool draw)
+  {
+    // draw the stats, clipped to their box, or put the menu items back
+    if (draw)
+    {
+      Scratch::Scope scope;
+      char* pStats = (char*)scope.Take(STATS_FORMAT_LEN);
+      Stats::Format(pStats);
+      DrawTextLine(kStatsX, 0, kStatsW, MENU_BAR_HEIGHT - 1, 0, MENU_TEXT_Y, pStats, false);
+    }
+    else
+    {
+      LCD_FILL_RECT(kStatsX, 0, kStatsW, MENU_BAR_HEIGHT - 1, LCD_WHITE);
+      DrawMenuItems();
+    }
+  }
+#endif
+
+  bool InRect(int x, int y, uint16_t rx, uint16_t ry, uint16_t rw, uint16_t rh)
+  {
+    // true if x, y is inside rx, ry, rw, rh
+    return (int)rx <= x && x < (int)(rx + rw) && (int)ry <= y && y < (int)(ry + rh);
+  }
+
+  void ShowNow(bool next)
+  {
+    // show the current (or next) slide straight away, resuming if paused
+    if (paused)
+    {
+      paused = false;
+      DrawMenuMessage(pPausedMsg, paused);
+    }
+    getNextSlide = next;
+    TimeToNextImageMS = 0;
+  }
+
+#ifdef CFG_HISTORY_SIZE
+  const uint16_t kHistoryEdgeW = 40; // the edges of the slide that step back and forward
+
+  int8_t HistoryEdge(int x, int y)
+  {
+    // -1 for a touch at x, y on the back edge of the slide, 1 for forward, else 0
+    const uint16_t imageY = kDrawWindowY + kDrawWindowTitleH + 1;
+    if (InRect(x, y, kDrawWindowX, imageY, kHistoryEdgeW, kDrawWindowImageH))
+      return -1;
+    if (InRect(x, y, kDrawWindowX + kDrawWindowImageW - kHistoryEdgeW, imageY, kHistoryEdgeW, kDrawWindowImageH))
+      return 1;
+    return 0;
+  }
+
+  bool HistoryTouch(int x, int y)
+  {
+    // step back or forward for a touch at x, y on an edge of the slide, true if it was one
+    int8_t edge = HistoryEdge(x, y);
+    if (edge < 0)
+    {
+      if (Slides::Back())
+        ShowNow(false);
+    }
+    else if (edge > 0)
+      ShowNow(true); // forward through the history, or the next slide
+    return edge;
+  }
+#endif
+
+#ifdef CFG_FATBITS
+  // FatBits, zooming in on the paused slide
+  #define ZOOM_MAX 8
+  uint8_t zoom = 0; // 0 is off, else 2, 4 or 8
+  int zoomX = 0;    // the touch zoomed in on
+  int zoomY = 0;
+
+  bool ZoomTouch(int x, int y)
+  {
+    // zoom further in on the paused slide at x, y (the first touch), true if it was zoomed
+    if (!paused)
+      return false;
+    if (zoom == ZOOM_MAX)
+    {
+      // zoomed out, show the whole slide again now
+      zoom = 0;
+      getNextSlide = false;
+      TimeToNextImageMS = 0;
+      return false;
+    }
+    if (!zoom)
+    {
+      zoomX = x;
+      zoomY = y;
+    }
+    zoom = zoom?2*zoom:2;
+    DrawBusy(true);
+    if (!Slides::PaintZoomed(kDrawWindowX, kDrawWindowY + kDrawWindowTitleH + 1, kDrawWindowImageW, kDrawWindowImageH, zoomX, zoomY, zoom))
+      zoom = ZOOM_MAX; // the next touch resumes
+    DrawBusy(false);
+    return true;
+  }
+#endif
+
+#ifdef CFG_THUMBNAIL_FOLDER
+  // browsing thumbnails, a sheet of them in the drawing window and a strip of the sheets in the fill window
+  static const char pBrowseTitle[] PROGMEM = "Slides";
+  const uint16_t kSheetColumns = 7;
+  const uint16_t kSheetRows = 6;
+  const uint16_t kSheetCellW = kDrawWindowImageW / kSheetColumns; // 56
+  const uint16_t kSheetCellH = kDrawWindowImageH / kSheetRows;    // 36
+  const uint16_t kSheetCount = kSheetColumns * kSheetRows;
+  const uint16_t kStripCount = 8;
+  const uint16_t kStripCellW = kFillWindowW / kStripCount;        // 50
+  bool browsing = false;
+  uint16_t sheet = 0;
+  uint16_t sheetCount = 0; // thumbnails on the sheet
+
+  void DrawSheet()
+  {
+    // draw the current sheet of thumbnails, and the strip with the first of each sheet around it
+    const uint16_t imageY = kDrawWindowY + kDrawWindowTitleH + 1;
+    LCD_FILL_RECT(kDrawWindowX, imageY, kDrawWindowImageW, kDrawWindowImageH, LCD_WHITE);
+    sheetCount = Slides::PaintThumbnails(sheet * kSheetCount, 1, kSheetCount,
+                                         kDrawWindowX + (kSheetCellW - SLIDE_THUMB_W) / 2, imageY + (kSheetCellH - SLIDE_THUMB_H) / 2,
+                                         kSheetColumns, kSheetCellW, kSheetCellH);
+    uint16_t stripFirst = sheet - sheet % kStripCount;
+    uint16_t stripY = kFillWindowY + (kFillWindowH - SLIDE_THUMB_H) / 2;
+    LCD_FILL_RECT(kFillWindowX, kFillWindowY, kFillWindowW, kFillWindowH, LCD_WHITE);
+    Slides::PaintThumbnails(stripFirst * kSheetCount, kSheetCount, kStripCount,
+                            kFillWindowX + (kStripCellW - SLIDE_THUMB_W) / 2, stripY, kStripCount, kStripCellW, 0);
+    // frame the current sheet
+    DrawRect(kFillWindowX + (sheet - stripFirst) * kStripCellW, stripY - 1, kStripCellW, SLIDE_THUMB_H + 2);
+  }
+
+  bool BrowseTouch(int x, int y)
+  {
+    // handle a touch at x, y for browsing, true if it was one
+    if (!browsing)
+    {
+      if (!InRect(x, y, kToolWindowX, kToolWindowY, kToolWindowW, kToolWindowH))
+        return false;
+      // tools window, start browsing
+      browsing = true;
+      sheet = 0;
+      DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pBrowseTitle, true);
+      DrawSheet();
+      return true;
+    }
+    const uint16_t imageY = kDrawWindowY + kDrawWindowTitleH + 1;
+    if (InRect(x, y, kFillWindowX, kFillWindowY, kFillWindowW, kFillWindowH))
+    {
+      // another sheet from the strip
+      sheet -= sheet % kStripCount;
+      sheet += (x - kFillWindowX) / kStripCellW;
+      DrawSheet();
+      return true;
+    }
+    if (InRect(x, y, kDrawWindowX, imageY, kSheetColumns * kSheetCellW, kSheetRows * kSheetCellH))
+    {
+      // a thumbnail, show its slide
+      uint16_t cell = ((y - imageY) / kSheetCellH) * kSheetColumns + (x - kDrawWindowX) / kSheetCellW;
+      if (cell < sheetCount)
+        Slides::Select(sheet * kSheetCount + cell);
+    }
+    // done, restore the fill window and show the (selected or current) slide now
+    browsing = false;
+    Compose(kFillWindowX, kFillWindowY, kFillWindowW, kFillWindowH);
+    Slides::Invalidate();
+    ShowNow(false);
+    return true;
+  }
+#endif
+
+#ifdef CFG_TOUCH_SAMPLER
+  bool GetTap(int& touchX, int& touchY)
+  {
+    // true once for each touch, from the sampler's presses. Doesn't wait for the stylus to lift
+    LCD_TouchEvent event;
+    while (LCD_TOUCH_EVENT(event))
+      if (event.type == LCD_TOUCH_PRESS)
+      {
+        touchX = event.x;
+        touchY = event.y;
+#ifdef DEBUG
+        Serial.print(";tap latency ");Serial.print(millis() - event.ms);Serial.println("ms");
+#endif
+        return true;
+      }
+    return false;
+  }
+#else
+  #define TOUCH_SAMPLE_COUNT_SHIFT 3 // 8 samples
+  #define TOUCH_SAMPLE_COUNT (1 << TOUCH_SAMPLE_COUNT_SHIFT)
+  byte _xSamples[TOUCH_SAMPLE_COUNT];
+  byte _ySamples[TOUCH_SAMPLE_COUNT];
+  byte _sampleCount = 0;
+  byte _sampleIdx = 0;
+  
+  int Average(byte* pSamples)
+  {
+    // return the average sample, TIMES TWO
+    int sum = 0;
+    for (int i = 0; i < TOUCH_SAMPLE_COUNT; i++)
+      sum += *pSamples++;
+    return sum >> (TOUCH_SAMPLE_COUNT_SHIFT - 1);
+  }
+  
+  bool GetStableTouch(int& touchX, int& touchY)
+  {
+    // true if there's a touch. averaged position (seems quite noisy)
+    // From AMeagreBall where RAM was tight, hence the byte-sized things
+    if (LCD_GET_TOUCH(touchX, touchY))
+    {
+      // discard LSB so they fit in a byte (HALVED)
+      touchX >>= 1;
+      touchY >>= 1;
+      if (_sampleCount == TOUCH_SAMPLE_COUNT)
+      {
+        _xSamples[_sampleIdx] = touchX;
+        _ySamples[_sampleIdx] = touchY;
+        _sampleIdx++;
+        if (_sampleIdx >= TOUCH_SAMPLE_COUNT)
+          _sampleIdx = 0;
+        touchX = Average(_xSamples);
+        touchY = Average(_ySamples);
+        _sampleCount = _sampleIdx = 0; // reset
+        return true;
+      }
+      else
+      {
+        // just add the samples
+        _xSamples[_sampleIdx] = touchX;
+        _ySamples[_sampleIdx] = touchY;
+        _sampleCount = ++_sampleIdx;
+        return false;
+      }
+    }
+    else
+    {
+      _sampleCount = _sampleIdx = 0;
+      return false;
+    }
+  }
+
+  bool touchHeld = false; // a tap's been taken, waiting for the stylus to lift
+
+  bool GetTap(int& touchX, int& touchY)
+  {
+    // true once for each touch, at its averaged position. Doesn't wait for the stylus to lift
+    if (touchHeld)
+    {
+      touchHeld = LCD_GET_TOUCH(touchX, touchY);
+      return false;
+    }
+    touchHeld = GetStableTouch(touchX, touchY);
+    return touchHeld;
+  }
+#endif
+
+  void Init()
+  {
+    // draw the entire screen...
+    
+    // the static layout (windows, tools, fills etc) in one pass
+    SERIALISE_ON(true);
+    Compose(0, 0, LCD_WIDTH, LCD_HEIGHT);
+
+#ifdef DEBUG
+    DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pUntitled, true);
+    DrawMenuItems();
+#else
+    // if splash, no main menu
+    DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pSplash, true);
+    DrawSplash(true);
+#endif    
+    
+#ifndef DEBUG
+    delay(5000);  // dwell on splash
+    // if splash, draw main menu
+    DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, pUntitled, true);
+    DrawMenuItems();
+    DrawSplash(false);
+#endif
+
+#ifdef CFG_SERIAL_INGEST
+    Ingest::Begin();
+#endif
+    DrawBusy(true, true);
+    Slides::GetFirst();
+    DrawBusy(false);
+    getNextSlide = false;
+    LastImageAtMS = millis();
+    TimeToNextImageMS = 2000UL; // blank at the start
+  }
+
+#ifdef CFG_LCD_HAS_TOUCH
+  bool InImageWindow(int x, int y)
+  {
+    // true if x, y is in the image window, title and all
+    return (int)kDrawWindowX <= x && x <= (int)(kDrawWindowX + kDrawWindowW) &&
+           (int)kDrawWindowY <= y && y <= (int)(kDrawWindowY + kDrawWindowH);
+  }
+
+  void Tapped(int x, int y, bool stopped)
+  {
+    // act on a tap at x, y. stopped if it stopped a slide painting, then a tap that's not for
+    // anything else skips to the next slide
+#ifdef CFG_SHOW_TOUCH          
+    LCD_FILL_RECT(x - 3, y, 7, 1, RGB(255,0,0));
+    LCD_FILL_RECT(x, y - 3, 1, 7, RGB(255,0,0));
+#endif        
+#ifdef CFG_THUMBNAIL_FOLDER
+    if (BrowseTouch(x, y))
+      ; // browsing
+    else
+#endif
+#ifdef CFG_HISTORY_SIZE
+    if (HistoryTouch(x, y))
+      ; // stepped
+    else
+#endif
+#ifdef CFG_STATS
+    if (y < MENU_BAR_HEIGHT)
+    {
+      // touch in the menu bar, show/hide the stats
+      showStats = !showStats;
+      DrawStats(showStats);
+    }
+    else
+#endif
+    if (InImageWindow(x, y))
+    {
+      // touch in image window, pause/resume
+#ifdef CFG_FATBITS
+      // (or zoom in, while paused)
+      if (!ZoomTouch(x, y))
+#endif
+      {
+        paused = !paused;
+        DrawMenuMessage(pPausedMsg, paused);
+      }
+    }
+    else if (stopped)
+      ShowNow(true);
+    else if (!paused)
+    {
+      // touch elsewhere, randomize. 
+      // PRNG is seeded from millis(), touch position and current image file name.
+      DrawMenuMessage(pSeedMsg, true);
+      uint32_t seed = x*y; 
+      seed += millis();
+      seed ^= Slides::NameAsSeed();
+      randomSeed(seed);
+      delay(1000); // show msg briefly
+      DrawMenuMessage(pSeedMsg, false);
+    }
+  }
+
+  // a tap taken while a slide painted, acted on once it's stopped
+  bool paintTapped = false;
+  bool paintStopped = false;
+  int paintTapX = 0;
+  int paintTapY = 0;
+
+  bool PollTouch()
+  {
+    // Slides::PaintPoll, one touch sample between rows of a painting slide. True to stop painting:
+    // a tap in the image (not on a history edge) pauses once it's painted, any other stops it
+    if (paintTapped || !GetTap(paintTapX, paintTapY))
+      return false;
+    paintTapped = true;
+    paintStopped = !InImageWindow(paintTapX, paintTapY);
+#ifdef CFG_HISTORY_SIZE
+    paintStopped = paintStopped || HistoryEdge(paintTapX, paintTapY);
+#endif
+    return paintStopped;
+  }
+#endif
+
+  bool Streaming()
+  {
+    // true while a slide streamed over Serial takes over
+#ifdef CFG_SERIAL_INGEST
+    return Ingest::Receiving();
+#else
+    return false;
+#endif
+  }
+
+#ifdef CFG_SERIAL_INGEST
+  void IngestTask()
+  {
+    // take what's arrived of a streamed slide
+    Scratch::Scope scope;
+    char* pStreamName = (char*)scope.Take(SLIDE_APPENDED_TEXT_MAX_LEN + 1);
+    uint8_t ingest = Ingest::Poll(kDrawWindowX, kDrawWindowY + kDrawWindowTitleH + 1, kDrawWindowImageW, kDrawWindowImageH, pStreamName);
+    if (ingest == INGEST_ENDED)
+    {
+      // the old title stays while it's drawn, then only the columns that change are redrawn
+      DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, *pStreamName?pStreamName:pUntitled, !*pStreamName);
+      LastImageAtMS = millis();
+#ifdef CFG_CADENCE
+      earlyMS = 0;
+#endif
+      TimeToNextImageMS = CFG_SECONDS_BETWEEN_IMAGES * 1000UL;
+    }
+  }
+#endif
+
+  void SlideTask()
+  {
+    // checks if it's time for the next slide, and shows it
+    if (Streaming())
+      return;
+    uint32_t NowMS = millis();
+    bool showing = !paused;
+#ifdef CFG_THUMBNAIL_FOLDER
+    showing = showing && !browsing;
+#endif
+#ifdef CFG_CADENCE
+    // start early enough for it to appear on time
+    uint32_t dueMS = NextDueMS();
+    if (showing && (int32_t)(NowMS - dueMS) >= -(int32_t)workEstimateMS)
+#else
+    if (showing && (NowMS - LastImageAtMS) >= TimeToNextImageMS)
+#endif
+    {
+#ifdef CFG_CADENCE
+      // only a slide started before it was due can miss (not one shown now, or after a pause)
+      bool scheduled = TimeToNextImageMS && (int32_t)(dueMS - NowMS) >= 0;
+#endif
+      // next slide
+      // scanning the dir may take a long time, show the busy cursor
+      DrawBusy(true, true);
+      STATS_START(STATS_SCAN)
+      if (getNextSlide)
+        Slides::GetNext();
+      STATS_STOP(STATS_SCAN)
+      getNextSlide = true;
+      Scratch::Scope scope;
+      char* pFileName = (char*)scope.Take(SLIDE_APPENDED_TEXT_MAX_LEN + 1);
+      DrawBusy(true);
+#ifdef CFG_FATBITS
+      zoom = 0;
+#endif
+#ifdef CFG_LCD_HAS_TOUCH
+      // taps are sampled while it paints
+      paintTapped = false;
+      Slides::PaintPoll pPoll = PollTouch;
+#else
+      Slides::PaintPoll pPoll = NULL;
+#endif
+      bool painted = Slides::PaintCurrent(kDrawWindowX, kDrawWindowY + kDrawWindowTitleH + 1, kDrawWindowImageW, kDrawWindowImageH, pFileName, pPoll);
+      bool haveName = strlen(pFileName);
+      STATS_START(STATS_TITLE)
+      // the old title stays while it's drawn, then only the columns that change are redrawn
+      DrawImageTitleText(kDrawWindowX, kDrawWindowY, kDrawWindowW, kDrawWindowTitleH, haveName?pFileName:NULL, false);
+      STATS_STOP(STATS_TITLE)
+      STATS_SLIDE()
+#ifdef CFG_STATS
+      if (showStats)
+        DrawStats(true);
+#endif
+      DrawBusy(false);
+#ifdef CFG_CADENCE
+      Cadence(NowMS, dueMS, scheduled);
+#else
+      LastImageAtMS = millis();
+#endif
+      if (painted)
+        TimeToNextImageMS = Slides::Dwell();
+      else
+        TimeToNextImageMS = haveName?1:0; // go to next quickly. Flash bad file name
+      TimeToNextImageMS *= 1000UL;
+#ifdef CFG_LCD_HAS_TOUCH
+      if (paintTapped)
+        Tapped(paintTapX, paintTapY, paintStopped);
+#endif
+    }
+  }
+
+#ifdef CFG_LCD_HAS_TOUCH    
+  void TouchTask()
+  {
+    // act on a tap
+    int x, y;
+    if (!Streaming() && GetTap(x, y))
+      Tapped(x, y, false);
+  }
+#endif
+
+#ifdef DEBUG
+  void ReportTask();
+#endif
+
+  // What Loop() runs, in order. The budgets are only for the stats
+  Tasks::Task tasks[] = 
+  {
+#ifdef CFG_SERIAL_INGEST
+    TASK(IngestTask, 0, 20),
+#endif
+    TASK(SlideTask, 0, 5000),   // (it paints)
+#ifdef CFG_LCD_HAS_TOUCH    
+    TASK(TouchTask, 0, 100),
+#endif
+#ifdef DEBUG
+    TASK(ReportTask, 60000, 100),
+#endif
+  };
+  const uint8_t kTaskCount = sizeof(tasks) / sizeof(tasks[0]);
+
+#ifdef DEBUG
+  void ReportTask()
+  {
+    // the scheduler's stats, every minute
+    Tasks::Report(tasks, kTaskCount);
+    Memory::Report();
+#ifdef CFG_STATS
+    Stats::Dump();
+#endif
+#ifdef CFG_SLEEP
+    Power::Report();
+#endif
+  }
+#endif
+
+#ifdef CFG_SLEEP
+  uint32_t IdleMS()
+  {
+    // how long there's nothing to do but wait for a touch
+#if defined(CFG_LCD_HAS_TOUCH) && !defined(CFG_TOUCH_SAMPLER)
+    if (touchHeld || _sampleCount)
+      return 0; // a tap's being taken
+#endif
+    bool showing = !paused;
+#ifdef CFG_THUMBNAIL_FOLDER
+    showing = showing && !browsing;
+#endif
+    if (!showing)
+      return 0xFFFFFFFFUL;
+#ifdef CFG_CADENCE
+    int32_t leftMS = (int32_t)(NextDueMS() - millis()) - (int32_t)workEstimateMS;
+    return (leftMS > 0)?leftMS:0;
+#else
+    uint32_t waitedMS = millis() - LastImageAtMS;
+    return (waitedMS < TimeToNextImageMS)?(TimeToNextImageMS - waitedMS):0;
+#endif
+  }
+#endif
+
+  void Loop()
+  {
+    // called on main loop, runs the tasks that are due
+    Tasks::RunDue(tasks, kTaskCount);
+#ifdef CFG_SLEEP
+    Power::Sleep(IdleMS());
+#endif
+  }
+  
+}
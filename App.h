@@ -1,8 +1,8 @@
-#pragma once
-
-// Main App logic and loop
-namespace App
-{
-  void Init();
-  void Loop();
-};
+#pragma once
+
+// Main App logic and loop
+namespace App
+{
+  void Init();
+  void Loop();
+};
@@ -1,59 +1,131 @@
-#pragma once
-
-// Configuration of many things!
-
-// If defined, Serial output, no splash, etc
-//#define DEBUG
-
-// Defines path to images, use "/" for root.
-#define CFG_IMAGE_FOLDER      "SLIDES/"
-
-// Defines interval between images.
-// This is the *minimum*. The interval may be longer if slides are random.
-#define CFG_SECONDS_BETWEEN_IMAGES 10
-
-// If defined, images are shown in random order.  
-// This adds an additional delay between images as the directory is scanned, ~40ms/file?
-// If not defined, images cycle in directory listing order (saves ~320 program storage bytes).
-#define CFG_RANDOM_ORDER
-
-// If defined, uses appended file name instead of 8.3, if found.
-#define CFG_READ_IMAGE_NAME
-
-// If defined, filenames are shown with trailing .BMP/JPG extension, otherwise it is stripped.
-//#define CFG_SHOW_IMAGE_EXT
-
-// If defined, filenames are show lowercase.
-//#define CFG_LOWERCASE_IMAGE_NAME
-
-// If defined, greyscale images are supported. 
-// File must use 4-bit, but code can show 4, 2 or 1 bit.
-// Greyscale is not as consistent with the look of the rest of the display, but does give better images.
-// Undefining to remove support saves ~440 program storage bytes.
-#define CFG_GREYSCALE_BITS  4
-
-// Colour used to fill empty gaps either side of slide, LCD_BLACK or LCD_WHITE.
-#define CFG_GAP_FILL_COLOUR LCD_WHITE
-
-// If defined, image rows are drawn in pseudo-random order, otherwise top-down (off saves ~220 program storage bytes).
-#define CFG_DISSOLVE
-
-// If defined, LCD supports touch and touching pauses/resumes/randomises slides (off saves ~1000 program storage bytes).
-#define CFG_LCD_HAS_TOUCH
-
-// If defined, LCD is Landscape, Uno USB on the left, else on the right.
-#define CFG_LCD_USB_LEFT
-
-// If defined, splash includes icon and help line (off saves ~450 program storage bytes).
-#define CFG_FULL_SPLASH
-
-// If defined, a small disk or watch icon is shown on the far right of the menu bar when
-// scanning the SD card for the next slide, or while painting the slide, respectively.
-#define CFG_SHOW_BUSY_ICONS
-
-// If defined, draws a small red cross at computed touch point. 
-// *** Don't expect perfect correlation! ***
-//#define CFG_SHOW_TOUCH
-
-// If defined, reports raw touch values to Serial at 9600. Use to update TOUCH_ defines in LCD.cpp. Requires DEBUG
-//#define CFG_TOUCH_CALIB
+#pragma once
+
+// Configuration of many things!
+
+// If defined, Serial output, no splash, etc
+//#define DEBUG
+
+// Defines path to images, use "/" for root.
+#define CFG_IMAGE_FOLDER      "SLIDES/"
+
+// Defines interval between images.
+// This is the *minimum*. The interval may be longer if slides are random.
+#define CFG_SECONDS_BETWEEN_IMAGES 10
+
+// If defined, slides appear CFG_SECONDS_BETWEEN_IMAGES apart (or as the playlist says), rather than that long after
+// the last one finished painting: each is started early by a running estimate of the time to find and paint one.
+// If DEBUG, slides that still appear late (by more than this many ms) are reported to Serial as deadline misses.
+//#define CFG_CADENCE 250
+
+// If defined, and this file is in CFG_IMAGE_FOLDER, it sets the order of the slides and, optionally, how long each 
+// is shown for: one "<8.3 name> [<seconds>]" per line (blank lines and ones starting with # are skipped).
+// It's read a line at a time, so it can be any length. Otherwise the folder is used, as below.
+//#define CFG_PLAYLIST "PLAYLIST.TXT"
+
+// If defined, images are shown in random order.  
+// This adds an additional delay between images as the directory is scanned, ~40ms/file?
+// If not defined, images cycle in directory listing order (saves ~320 program storage bytes).
+#define CFG_RANDOM_ORDER
+
+// If defined, uses appended file name instead of 8.3, if found.
+#define CFG_READ_IMAGE_NAME
+
+// If defined, filenames are shown with trailing .BMP/JPG extension, otherwise it is stripped.
+//#define CFG_SHOW_IMAGE_EXT
+
+// If defined, filenames are show lowercase.
+//#define CFG_LOWERCASE_IMAGE_NAME
+
+// If defined, greyscale images are supported. 
+// File must use 4-bit, but code can show 4, 2 or 1 bit.
+// Greyscale is not as consistent with the look of the rest of the display, but does give better images.
+// Undefining to remove support saves ~440 program storage bytes.
+#define CFG_GREYSCALE_BITS  4
+
+// Colour used to fill empty gaps either side of slide, LCD_BLACK or LCD_WHITE.
+#define CFG_GAP_FILL_COLOUR LCD_WHITE
+
+// How slides are revealed, one of (see Transitions.h):
+//  TRANSITION_NONE, TRANSITION_DISSOLVE, TRANSITION_BLINDS, TRANSITION_INTERLACE, TRANSITION_WIPE_UP, 
+//  TRANSITION_WIPE_RIGHT, TRANSITION_BLOCKS, TRANSITION_PROGRESSIVE or
+//  TRANSITION_RANDOM for a different one for each slide.
+// TRANSITION_PROGRESSIVE shows the whole slide coarsely first, then refines it.
+// If DEBUG, the SD sectors read and time taken (and time until the whole slide was covered) are reported to Serial.
+#define CFG_TRANSITION TRANSITION_DISSOLVE
+
+// If defined, the first showing of a slide writes a transcoded copy to this folder (created if needed): 
+// pre-clipped, top-down and run-length-encoded, so it paints with no per-pixel work.
+// Later showings use the copy while the source's size and a checksum of a sample of it still match.
+// The first showing is painted top-down (no transition), so the copy is written in order.
+// Delete the folder to force slides to be transcoded again.
+//#define CFG_SLIDE_CACHE_FOLDER "CACHE/"
+// RAM buffer for writing (and reading) the transcoded copy. Writes go through the SD library's block cache, 
+// which can make the first showing re-read the source's sectors. 512 (a sector) bypasses it, for a quarter of the RAM.
+#define CFG_SLIDE_CACHE_BUFFER 64
+
+// If defined, a signature of each row on screen is kept and a slide only repaints the rows that differ,
+// comparing each as it's read; the gap fills are skipped when they're already there.
+// Rows are compared if the transition paints each once, whole (not TRANSITION_WIPE_RIGHT, TRANSITION_BLOCKS or
+// TRANSITION_PROGRESSIVE) and the row's source fits the read buffer (~200 bytes, not reduced 4BPP slides).
+// With CFG_SLIDE_CACHE_FOLDER the signatures are cached too. Costs ~590 bytes of RAM (with a bigger scratch block).
+//#define CFG_DIFF_REPAINT
+// The signatures are 16 bits, so a changed row can match the old one (~1 in 65536) and be left on screen.
+// Every this many compared slides, all the rows are repainted so such a row doesn't stay. 1 repaints every slide.
+#define CFG_DIFF_REFRESH 16
+
+// If defined, the names of this many recently shown slides are kept. Touching the left or right edge of the slide
+// steps back or forward through them (forward from the newest is the next slide). Costs 13 bytes of RAM each.
+//#define CFG_HISTORY_SIZE 8
+
+// If defined, touching a paused slide zooms in on that point, FatBits style, at 2x, 4x then 8x. 
+// The next touch shows the whole slide again and resumes.
+//#define CFG_FATBITS
+
+// If defined, touching the tools window shows a sheet of thumbnails of the slides (touch one to show it), with a
+// strip of the pages of them in the fill window. The thumbnails are made by make_slides.bat, in this folder.
+// Requires CFG_LCD_HAS_TOUCH.
+//#define CFG_THUMBNAIL_FOLDER CFG_IMAGE_FOLDER "THUMBS/"
+
+// If defined, slides can also be streamed over Serial at this baud rate (see resources/stream_slides.py).
+// A streamed slide is shown for CFG_SECONDS_BETWEEN_IMAGES, then the SD card slides carry on. Not with DEBUG.
+//#define CFG_SERIAL_INGEST 115200
+
+// If defined, the time each slide spends in each phase (finding, opening, reading, pushing to the LCD etc)
+// is measured. Touching the menu bar shows the last slide's in place of the menu. If DEBUG, the min, max and
+// mean of each are reported with the task stats. The line is drawn from a bigger scratch block (Scratch.h).
+//#define CFG_STATS
+
+// If defined, the Uno powers down between slides, woken by the watchdog in time for the next one, or by a touch.
+// millis() is wound on by the time asleep, as the watchdog times it (to ~10%). If DEBUG, the time awake and asleep
+// is reported with the task stats. Not with CFG_SERIAL_INGEST (Serial can't wake it, checked below).
+//#define CFG_SLEEP
+
+// If defined, LCD supports touch and touching pauses/resumes/randomises slides (off saves ~1000 program storage bytes).
+#define CFG_LCD_HAS_TOUCH
+
+// If defined, touch is sampled in the background (Timer2, between LCD writes) and median filtered, so a tap
+// registers sooner and nothing waits on the panel. If DEBUG, the tap latency is reported to Serial. 
+// Requires CFG_LCD_HAS_TOUCH, and Timer2 (no tone()).
+//#define CFG_TOUCH_SAMPLER
+
+// If defined, LCD is Landscape, Uno USB on the left, else on the right.
+#define CFG_LCD_USB_LEFT
+
+// If defined, splash includes icon and help line (off saves ~450 program storage bytes).
+#define CFG_FULL_SPLASH
+
+// If defined, a small disk or watch icon is shown on the far right of the menu bar when
+// scanning the SD card for the next slide, or while painting the slide, respectively.
+#define CFG_SHOW_BUSY_ICONS
+
+// If defined, draws a small red cross at computed touch point. 
+// *** Don't expect perfect correlation! ***
+//#define CFG_SHOW_TOUCH
+
+// If defined, reports raw touch values to Serial at 9600. Use to update TOUCH_ defines in LCD.cpp. Requires DEBUG
+//#define CFG_TOUCH_CALIB
+
+// Combinations that can't work
+#if defined(CFG_SLEEP) && defined(CFG_SERIAL_INGEST)
+#error "CFG_SLEEP can't be used with CFG_SERIAL_INGEST, power-down stops the UART so streamed slides would be lost"
+#endif
@@ -1,312 +1,346 @@
-// (created from "Chicago-12.bdf" by encode_font.py)
-#define FONT_HEIGHT    12
-#define FONT_DESCENDER  3
-static const uint8_t Font[] PROGMEM =
-{
-  // char
-  // (w, h):0bwwwwhhhh, (dx, dy):0bsxxxsyyy s:sign, 1=-ve
-  // 1BPP row data...
-  33,  // '!'
-  0x29, 0x20,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 
-  34,  // '"'
-  0x33, 0x26,
-  0xA0, 0xA0, 0xA0, 
-  35,  // '#'
-  0x88, 0x12,
-  0x12, 0x12, 0x7F, 0x24, 0x24, 0xFE, 0x48, 0x48, 
-  36,  // '$'
-  0x5B, 0x19,
-  0x20, 0x70, 0xA8, 0xE0, 0xE0, 0x70, 0x38, 0x38, 0xA8, 0x70, 0x20, 
-  37,  // '%'
-  0x9A, 0x10,
-  0x6E, 0x00, 0x92, 0x00, 0x94, 0x00, 0x64, 0x00, 0x08, 0x00, 0x08, 0x00, 0x13, 0x00, 0x14, 0x80, 0x24, 0x80, 0x23, 0x00, 
-  38,  // '&'
-  0x89, 0x10,
-  0x78, 0xCC, 0xCD, 0x61, 0xCE, 0xCC, 0xCC, 0xCC, 0x78, 
-  39,  // '''
-  0x13, 0x16,
-  0x80, 0x80, 0x80, 
-  40,  // '('
-  0x3B, 0x19,
-  0x20, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x20, 
-  41,  // ')'
-  0x3B, 0x19,
-  0x80, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x80, 
-  42,  // '*'
-  0x55, 0x14,
-  0x20, 0xA8, 0x70, 0xA8, 0x20, 
-  43,  // '+'
-  0x55, 0x12,
-  0x20, 0x20, 0xF8, 0x20, 0x20, 
-  44,  // ','
-  0x24, 0x1A,
-  0xC0, 0xC0, 0x40, 0x80, 
-  45,  // '-'
-  0x51, 0x14,
-  0xF8, 
-  46,  // '.'
-  0x22, 0x10,
-  0xC0, 0xC0, 
-  47,  // '/'
-  0x5A, 0x10,
-  0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 
-  48,  // '0'
-  0x69, 0x10,
-  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
-  49,  // '1'
-  0x39, 0x20,
-  0x60, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
-  50,  // '2'
-  0x69, 0x10,
-  0x78, 0x8C, 0x0C, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFC, 
-  51,  // '3'
-  0x69, 0x10,
-  0xFC, 0x18, 0x30, 0x78, 0x0C, 0x0C, 0x0C, 0x8C, 0x78, 
-  52,  // '4'
-  0x79, 0x10,
-  0x0C, 0x1C, 0x2C, 0x4C, 0x8C, 0xFE, 0x0C, 0x0C, 0x0C, 
-  53,  // '5'
-  0x69, 0x10,
-  0xFC, 0xC0, 0xC0, 0xF8, 0x0C, 0x0C, 0x0C, 0x8C, 0x78, 
-  54,  // '6'
-  0x69, 0x10,
-  0x38, 0x60, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
-  55,  // '7'
-  0x69, 0x10,
-  0xFC, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30, 
-  56,  // '8'
-  0x69, 0x10,
-  0x78, 0xCC, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0xCC, 0x78, 
-  57,  // '9'
-  0x69, 0x10,
-  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x18, 0x70, 
-  58,  // ':'
-  0x27, 0x10,
-  0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 
-  59,  // ';'
-  0x29, 0x1A,
-  0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x40, 0x80, 
-  60,  // '<'
-  0x57, 0x01,
-  0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 
-  61,  // '='
-  0x63, 0x13,
-  0xFC, 0x00, 0xFC, 
-  62,  // '>'
-  0x57, 0x01,
-  0xC0, 0x60, 0x30, 0x18, 0x30, 0x60, 0xC0, 
-  63,  // '?'
-  0x69, 0x10,
-  0x78, 0x8C, 0x0C, 0x18, 0x30, 0x30, 0x00, 0x30, 0x30, 
-  64,  // '@'
-  0x98, 0x10,
-  0x3E, 0x00, 0x41, 0x00, 0x9C, 0x80, 0xA4, 0x80, 0xA4, 0x80, 0x9B, 0x00, 0x40, 0x00, 0x3E, 0x00, 
-  65,  // 'A'
-  0x69, 0x10,
-  0x78, 0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 
-  66,  // 'B'
-  0x69, 0x10,
-  0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 
-  67,  // 'C'
-  0x69, 0x10,
-  0x78, 0xC4, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC4, 0x78, 
-  68,  // 'D'
-  0x69, 0x10,
-  0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8, 
-  69,  // 'E'
-  0x59, 0x10,
-  0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xC0, 0xC0, 0xC0, 0xF8, 
-  70,  // 'F'
-  0x59, 0x10,
-  0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 
-  71,  // 'G'
-  0x69, 0x10,
-  0x78, 0xC4, 0xC0, 0xC0, 0xDC, 0xCC, 0xCC, 0xCC, 0x78, 
-  72,  // 'H'
-  0x69, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 
-  73,  // 'I'
-  0x29, 0x20,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
-  74,  // 'J'
-  0x69, 0x00,
-  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0xCC, 0x78, 
-  75,  // 'K'
-  0x79, 0x10,
-  0xC6, 0xCC, 0xD8, 0xF0, 0xE0, 0xF0, 0xD8, 0xCC, 0xC6, 
-  76,  // 'L'
-  0x59, 0x10,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 
-  77,  // 'M'
-  0xA9, 0x10,
-  0x80, 0x40, 0xC0, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0xBE, 0xC0, 0x9C, 0xC0, 0x88, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 
-  78,  // 'N'
-  0x79, 0x10,
-  0x82, 0xC2, 0xE2, 0xF2, 0xBA, 0x9E, 0x8E, 0x86, 0x82, 
-  79,  // 'O'
-  0x69, 0x10,
-  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
-  80,  // 'P'
-  0x69, 0x10,
-  0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 
-  81,  // 'Q'
-  0x6A, 0x19,
-  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x0C, 
-  82,  // 'R'
-  0x69, 0x10,
-  0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 
-  83,  // 'S'
-  0x59, 0x10,
-  0x70, 0xC8, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x98, 0x70, 
-  84,  // 'T'
-  0x69, 0x00,
-  0xFC, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
-  85,  // 'U'
-  0x69, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
-  86,  // 'V'
-  0x69, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC8, 0xF0, 
-  87,  // 'W'
-  0xA9, 0x10,
-  0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0x80, 0xFF, 0x00, 
-  88,  // 'X'
-  0x69, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0xCC, 0xCC, 
-  89,  // 'Y'
-  0x69, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x30, 0x30, 0x30, 
-  90,  // 'Z'
-  0x69, 0x10,
-  0xFC, 0x0C, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xC0, 0xFC, 
-  91,  // '['
-  0x3B, 0x19,
-  0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 
-  92,  // '\'
-  0x5A, 0x10,
-  0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 
-  93,  // ']'
-  0x3B, 0x19,
-  0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 
-  94,  // '^'
-  0x53, 0x26,
-  0x20, 0x50, 0x88, 
-  95,  // '_'
-  0x81, 0x00,
-  0xFF, 
-  96,  // '`'
-  0x33, 0x17,
-  0x80, 0x40, 0x20, 
-  97,  // 'a'
-  0x67, 0x10,
-  0x78, 0x8C, 0x7C, 0xCC, 0xCC, 0xCC, 0x7C, 
-  98,  // 'b'
-  0x69, 0x10,
-  0xC0, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8, 
-  99,  // 'c'
-  0x57, 0x10,
-  0x70, 0xC8, 0xC0, 0xC0, 0xC0, 0xC8, 0x70, 
-  100,  // 'd'
-  0x69, 0x10,
-  0x0C, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 
-  101,  // 'e'
-  0x67, 0x10,
-  0x78, 0xCC, 0xCC, 0xFC, 0xC0, 0xC4, 0x78, 
-  102,  // 'f'
-  0x59, 0x10,
-  0x38, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
-  103,  // 'g'
-  0x6A, 0x1B,
-  0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x8C, 0x78, 
-  104,  // 'h'
-  0x69, 0x10,
-  0xC0, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-  105,  // 'i'
-  0x29, 0x10,
-  0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
-  106,  // 'j'
-  0x5C, 0x0B,
-  0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0x70, 
-  107,  // 'k'
-  0x69, 0x10,
-  0xC0, 0xC0, 0xCC, 0xD8, 0xF0, 0xE0, 0xF0, 0xD8, 0xCC, 
-  108,  // 'l'
-  0x29, 0x10,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
-  109,  // 'm'
-  0xA7, 0x10,
-  0xFF, 0x80, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 
-  110,  // 'n'
-  0x67, 0x10,
-  0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-  111,  // 'o'
-  0x67, 0x10,
-  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
-  112,  // 'p'
-  0x69, 0x1A,
-  0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8, 0xC0, 0xC0, 
-  113,  // 'q'
-  0x69, 0x1A,
-  0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x0C, 
-  114,  // 'r'
-  0x57, 0x10,
-  0xD8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
-  115,  // 's'
-  0x57, 0x10,
-  0x70, 0xC8, 0xE0, 0x70, 0x38, 0x98, 0x70, 
-  116,  // 't'
-  0x49, 0x10,
-  0x60, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 
-  117,  // 'u'
-  0x67, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 
-  118,  // 'v'
-  0x67, 0x10,
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC8, 0xF0, 
-  119,  // 'w'
-  0xA7, 0x10,
-  0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0x80, 0xFF, 0x00, 
-  120,  // 'x'
-  0x67, 0x10,
-  0xCC, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0xCC, 
-  121,  // 'y'
-  0x6A, 0x1B,
-  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x8C, 0x78, 
-  122,  // 'z'
-  0x67, 0x10,
-  0xFC, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFC, 
-  123,  // '{'
-  0x3B, 0x19,
-  0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 
-  124,  // '|'
-  0x1B, 0x29,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
-  125,  // '}'
-  0x3B, 0x19,
-  0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 
-  126,  // '~'
-  0x62, 0x15,
-  0x64, 0x98, 
-
-  127,  // <bullet>
-  0x55, 0x12,
-  0x70, 0xF8, 0xF8, 0xF8, 0x70, 
-  128,  // <apple>
-  0x9B, 0x10,
-  0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x77, 0x00, 0xFF, 0x80, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x00, 0x36, 0x00, 
-
-  // (not in font file)
-  129,  // <command>
-  0xA9, 0x00,
-  0b0110001, 0b10000000,
-  0b1001010, 0b01000000,
-  0b1001010, 0b01000000,
-  0b0111111, 0b10000000,
-  0b0001010, 0b00000000,
-  0b0111111, 0b10000000,
-  0b1001010, 0b01000000,
-  0b1001010, 0b01000000,
-  0b0110001, 0b10000000,
-  0
-}; // 1151 bytes
+// (created from "Chicago-12.bdf" by encode_font.py)
+#define FONT_HEIGHT    12
+#define FONT_DESCENDER  3
+static const uint8_t Font[] PROGMEM =
+{
+  // char
+  // (w, h):0bwwwwhhhh, (dx, dy):0bsxxxsyyy s:sign, 1=-ve
+  // 1BPP row data...
+  33,  // '!'
+  0x29, 0x20,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 
+  34,  // '"'
+  0x33, 0x26,
+  0xA0, 0xA0, 0xA0, 
+  35,  // '#'
+  0x88, 0x12,
+  0x12, 0x12, 0x7F, 0x24, 0x24, 0xFE, 0x48, 0x48, 
+  36,  // '$'
+  0x5B, 0x19,
+  0x20, 0x70, 0xA8, 0xE0, 0xE0, 0x70, 0x38, 0x38, 0xA8, 0x70, 0x20, 
+  37,  // '%'
+  0x9A, 0x10,
+  0x6E, 0x00, 0x92, 0x00, 0x94, 0x00, 0x64, 0x00, 0x08, 0x00, 0x08, 0x00, 0x13, 0x00, 0x14, 0x80, 0x24, 0x80, 0x23, 0x00, 
+  38,  // '&'
+  0x89, 0x10,
+  0x78, 0xCC, 0xCD, 0x61, 0xCE, 0xCC, 0xCC, 0xCC, 0x78, 
+  39,  // '''
+  0x13, 0x16,
+  0x80, 0x80, 0x80, 
+  40,  // '('
+  0x3B, 0x19,
+  0x20, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x20, 
+  41,  // ')'
+  0x3B, 0x19,
+  0x80, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x80, 
+  42,  // '*'
+  0x55, 0x14,
+  0x20, 0xA8, 0x70, 0xA8, 0x20, 
+  43,  // '+'
+  0x55, 0x12,
+  0x20, 0x20, 0xF8, 0x20, 0x20, 
+  44,  // ','
+  0x24, 0x1A,
+  0xC0, 0xC0, 0x40, 0x80, 
+  45,  // '-'
+  0x51, 0x14,
+  0xF8, 
+  46,  // '.'
+  0x22, 0x10,
+  0xC0, 0xC0, 
+  47,  // '/'
+  0x5A, 0x10,
+  0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 
+  48,  // '0'
+  0x69, 0x10,
+  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
+  49,  // '1'
+  0x39, 0x20,
+  0x60, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
+  50,  // '2'
+  0x69, 0x10,
+  0x78, 0x8C, 0x0C, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFC, 
+  51,  // '3'
+  0x69, 0x10,
+  0xFC, 0x18, 0x30, 0x78, 0x0C, 0x0C, 0x0C, 0x8C, 0x78, 
+  52,  // '4'
+  0x79, 0x10,
+  0x0C, 0x1C, 0x2C, 0x4C, 0x8C, 0xFE, 0x0C, 0x0C, 0x0C, 
+  53,  // '5'
+  0x69, 0x10,
+  0xFC, 0xC0, 0xC0, 0xF8, 0x0C, 0x0C, 0x0C, 0x8C, 0x78, 
+  54,  // '6'
+  0x69, 0x10,
+  0x38, 0x60, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
+  55,  // '7'
+  0x69, 0x10,
+  0xFC, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x30, 
+  56,  // '8'
+  0x69, 0x10,
+  0x78, 0xCC, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0xCC, 0x78, 
+  57,  // '9'
+  0x69, 0x10,
+  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x18, 0x70, 
+  58,  // ':'
+  0x27, 0x10,
+  0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 
+  59,  // ';'
+  0x29, 0x1A,
+  0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x40, 0x80, 
+  60,  // '<'
+  0x57, 0x01,
+  0x18, 0x30, 0x60, 0xC0, 0x60, 0x30, 0x18, 
+  61,  // '='
+  0x63, 0x13,
+  0xFC, 0x00, 0xFC, 
+  62,  // '>'
+  0x57, 0x01,
+  0xC0, 0x60, 0x30, 0x18, 0x30, 0x60, 0xC0, 
+  63,  // '?'
+  0x69, 0x10,
+  0x78, 0x8C, 0x0C, 0x18, 0x30, 0x30, 0x00, 0x30, 0x30, 
+  64,  // '@'
+  0x98, 0x10,
+  0x3E, 0x00, 0x41, 0x00, 0x9C, 0x80, 0xA4, 0x80, 0xA4, 0x80, 0x9B, 0x00, 0x40, 0x00, 0x3E, 0x00, 
+  65,  // 'A'
+  0x69, 0x10,
+  0x78, 0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 
+  66,  // 'B'
+  0x69, 0x10,
+  0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 
+  67,  // 'C'
+  0x69, 0x10,
+  0x78, 0xC4, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC4, 0x78, 
+  68,  // 'D'
+  0x69, 0x10,
+  0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8, 
+  69,  // 'E'
+  0x59, 0x10,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xC0, 0xC0, 0xC0, 0xF8, 
+  70,  // 'F'
+  0x59, 0x10,
+  0xF8, 0xC0, 0xC0, 0xC0, 0xF0, 0xC0, 0xC0, 0xC0, 0xC0, 
+  71,  // 'G'
+  0x69, 0x10,
+  0x78, 0xC4, 0xC0, 0xC0, 0xDC, 0xCC, 0xCC, 0xCC, 0x78, 
+  72,  // 'H'
+  0x69, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 
+  73,  // 'I'
+  0x29, 0x20,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+  74,  // 'J'
+  0x69, 0x00,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0xCC, 0x78, 
+  75,  // 'K'
+  0x79, 0x10,
+  0xC6, 0xCC, 0xD8, 0xF0, 0xE0, 0xF0, 0xD8, 0xCC, 0xC6, 
+  76,  // 'L'
+  0x59, 0x10,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 
+  77,  // 'M'
+  0xA9, 0x10,
+  0x80, 0x40, 0xC0, 0xC0, 0xE1, 0xC0, 0xF3, 0xC0, 0xBE, 0xC0, 0x9C, 0xC0, 0x88, 0xC0, 0x80, 0xC0, 0x80, 0xC0, 
+  78,  // 'N'
+  0x79, 0x10,
+  0x82, 0xC2, 0xE2, 0xF2, 0xBA, 0x9E, 0x8E, 0x86, 0x82, 
+  79,  // 'O'
+  0x69, 0x10,
+  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
+  80,  // 'P'
+  0x69, 0x10,
+  0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 
+  81,  // 'Q'
+  0x6A, 0x19,
+  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x0C, 
+  82,  // 'R'
+  0x69, 0x10,
+  0xF8, 0xCC, 0xCC, 0xCC, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 
+  83,  // 'S'
+  0x59, 0x10,
+  0x70, 0xC8, 0xC0, 0xE0, 0x70, 0x38, 0x18, 0x98, 0x70, 
+  84,  // 'T'
+  0x69, 0x00,
+  0xFC, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  85,  // 'U'
+  0x69, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
+  86,  // 'V'
+  0x69, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC8, 0xF0, 
+  87,  // 'W'
+  0xA9, 0x10,
+  0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0x80, 0xFF, 0x00, 
+  88,  // 'X'
+  0x69, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0xCC, 0xCC, 
+  89,  // 'Y'
+  0x69, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0x78, 0x30, 0x30, 0x30, 0x30, 
+  90,  // 'Z'
+  0x69, 0x10,
+  0xFC, 0x0C, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xC0, 0xFC, 
+  91,  // '['
+  0x3B, 0x19,
+  0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 
+  92,  // '\'
+  0x5A, 0x10,
+  0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 
+  93,  // ']'
+  0x3B, 0x19,
+  0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 
+  94,  // '^'
+  0x53, 0x26,
+  0x20, 0x50, 0x88, 
+  95,  // '_'
+  0x81, 0x00,
+  0xFF, 
+  96,  // '`'
+  0x33, 0x17,
+  0x80, 0x40, 0x20, 
+  97,  // 'a'
+  0x67, 0x10,
+  0x78, 0x8C, 0x7C, 0xCC, 0xCC, 0xCC, 0x7C, 
+  98,  // 'b'
+  0x69, 0x10,
+  0xC0, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8, 
+  99,  // 'c'
+  0x57, 0x10,
+  0x70, 0xC8, 0xC0, 0xC0, 0xC0, 0xC8, 0x70, 
+  100,  // 'd'
+  0x69, 0x10,
+  0x0C, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 
+  101,  // 'e'
+  0x67, 0x10,
+  0x78, 0xCC, 0xCC, 0xFC, 0xC0, 0xC4, 0x78, 
+  102,  // 'f'
+  0x59, 0x10,
+  0x38, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 
+  103,  // 'g'
+  0x6A, 0x1B,
+  0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x8C, 0x78, 
+  104,  // 'h'
+  0x69, 0x10,
+  0xC0, 0xC0, 0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
+  105,  // 'i'
+  0x29, 0x10,
+  0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+  106,  // 'j'
+  0x5C, 0x0B,
+  0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0x70, 
+  107,  // 'k'
+  0x69, 0x10,
+  0xC0, 0xC0, 0xCC, 0xD8, 0xF0, 0xE0, 0xF0, 0xD8, 0xCC, 
+  108,  // 'l'
+  0x29, 0x10,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+  109,  // 'm'
+  0xA7, 0x10,
+  0xFF, 0x80, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 
+  110,  // 'n'
+  0x67, 0x10,
+  0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
+  111,  // 'o'
+  0x67, 0x10,
+  0x78, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x78, 
+  112,  // 'p'
+  0x69, 0x1A,
+  0xF8, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xF8, 0xC0, 0xC0, 
+  113,  // 'q'
+  0x69, 0x1A,
+  0x7C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x0C, 
+  114,  // 'r'
+  0x57, 0x10,
+  0xD8, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 
+  115,  // 's'
+  0x57, 0x10,
+  0x70, 0xC8, 0xE0, 0x70, 0x38, 0x98, 0x70, 
+  116,  // 't'
+  0x49, 0x10,
+  0x60, 0x60, 0xF0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 
+  117,  // 'u'
+  0x67, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 
+  118,  // 'v'
+  0x67, 0x10,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC8, 0xF0, 
+  119,  // 'w'
+  0xA7, 0x10,
+  0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0xCC, 0x80, 0xFF, 0x00, 
+  120,  // 'x'
+  0x67, 0x10,
+  0xCC, 0xCC, 0xCC, 0x78, 0xCC, 0xCC, 0xCC, 
+  121,  // 'y'
+  0x6A, 0x1B,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7C, 0x0C, 0x8C, 0x78, 
+  122,  // 'z'
+  0x67, 0x10,
+  0xFC, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFC, 
+  123,  // '{'
+  0x3B, 0x19,
+  0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 
+  124,  // '|'
+  0x1B, 0x29,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 
+  125,  // '}'
+  0x3B, 0x19,
+  0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 
+  126,  // '~'
+  0x62, 0x15,
+  0x64, 0x98, 
+
+  127,  // <bullet>
+  0x55, 0x12,
+  0x70, 0xF8, 0xF8, 0xF8, 0x70, 
+  128,  // <apple>
+  0x9B, 0x10,
+  0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x77, 0x00, 0xFF, 0x80, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x80, 0xFF, 0x80, 0x7F, 0x00, 0x36, 0x00, 
+
+  // (not in font file)
+  129,  // <command>
+  0xA9, 0x00,
+  0b0110001, 0b10000000,
+  0b1001010, 0b01000000,
+  0b1001010, 0b01000000,
+  0b0111111, 0b10000000,
+  0b0001010, 0b00000000,
+  0b0111111, 0b10000000,
+  0b1001010, 0b01000000,
+  0b1001010, 0b01000000,
+  0b0110001, 0b10000000,
+  0
+}; // 1151 bytes
+
+#define FONT_FIRST_CHAR 32
+#define FONT_LAST_CHAR  129
+#define FONT_NO_GLYPH   0xFFFF
+// offset of each char's (w, h) byte in Font, FONT_NO_GLYPH if it has none
+static const uint16_t FontOffsets[] PROGMEM =
+{
+  65535, 1, 13, 19, 30, 44, 67, 79, 
+  85, 99, 113, 121, 129, 136, 140, 145, 
+  158, 170, 182, 194, 206, 218, 230, 242, 
+  254, 266, 278, 288, 300, 310, 316, 326, 
+  338, 357, 369, 381, 393, 405, 417, 429, 
+  441, 453, 465, 477, 489, 501, 522, 534, 
+  546, 558, 571, 583, 595, 607, 619, 631, 
+  652, 664, 676, 688, 702, 715, 729, 735, 
+  739, 745, 755, 767, 777, 789, 799, 811, 
+  824, 836, 848, 863, 875, 887, 904, 914, 
+  924, 936, 948, 958, 968, 980, 990, 1000, 
+  1017, 1027, 1040, 1050, 1064, 1078, 1092, 1097, 
+  1105, 1130, 
+}; // 196 bytes
+
+// advance width of each char, dx + w + 1
+static const uint8_t FontAdvances[] PROGMEM =
+{
+  4, 5, 6, 10, 7, 11, 10, 3, 5, 5, 7, 7, 4, 7, 4, 7, 
+  8, 6, 8, 8, 9, 8, 8, 8, 8, 8, 4, 4, 6, 8, 6, 8, 
+  11, 8, 8, 8, 8, 7, 7, 8, 8, 5, 7, 9, 7, 12, 9, 8, 
+  8, 8, 8, 7, 7, 8, 8, 12, 8, 8, 8, 5, 7, 5, 8, 9, 
+  5, 8, 8, 7, 8, 8, 7, 8, 8, 4, 6, 8, 4, 12, 8, 8, 
+  8, 8, 7, 7, 6, 8, 8, 12, 8, 8, 8, 5, 4, 5, 8, 7, 
+  11, 11, 
+}; // 98 bytes
+
@@ -1,341 +1,341 @@
-// (created from "MacPaint 480x320.png" by encode_graphics.py)
-// duplicate row encoding:
-#define BMP_ROW_ESC_MASK        0b11110000 // mask for escape byte
-#define BMP_ROW_ESC_VALUE       0b10100000 // escape byte
-#define BMP_ROW_ESC_IDX         0b00001111 // index to recent or initial
-#define BMP_ROW_ESC_IDX_BLACK   0b00001000 // index to black row
-
-static const uint8_t pToolsData[] PROGMEM =
-{
-  0,10, 0,29, 0,51, 0,197,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
-  0xA0,
-  0xA0,
-  0xA0,
-  0xFF, 0xE0, 0x3F, 0xBE, 0x18, 0x31, 0xE0,
-  0xFF, 0x1F, 0xCF, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xFE, 0xFF, 0xF7, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xFD, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xE0,
-  0xFB, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xE0,
-  0xFB, 0xFF, 0xCF, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xFB, 0xFE, 0x3F, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xFC, 0x71, 0xFF, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xF9, 0x8F, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
-  0xFA, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
-  0xFC, 0x7F, 0xFF, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xFF, 0x7F, 0xFF, 0xBE, 0xFF, 0xFD, 0xE0,
-  0xFF, 0x7F, 0xFF, 0xBE, 0x30, 0x61, 0xE0,
-  0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xFF, 0xF3, 0xFF, 0xBF, 0xFD, 0xFF, 0xE0,
-  0xFF, 0x2C, 0x7F, 0xBF, 0xF8, 0xFF, 0xE0,
-  0xFE, 0xCD, 0xBF, 0xBF, 0xF8, 0xFF, 0xE0,
-  0xFE, 0xCD, 0xAF, 0xBF, 0xF0, 0x7F, 0xE0,
-  0xFF, 0x6D, 0x97, 0xBF, 0xF4, 0x7F, 0xE0,
-  0xFF, 0x6D, 0xB7, 0xBF, 0xE6, 0x3F, 0xE0,
-  0xFC, 0xBF, 0xB7, 0xBF, 0xEE, 0x3F, 0xE0,
-  0xFB, 0x3F, 0xF7, 0xBF, 0xCF, 0x1F, 0xE0,
-  0xFB, 0xBF, 0xEF, 0xBF, 0xDF, 0x1F, 0xE0,
-  0xFD, 0xFF, 0xEF, 0xBF, 0x9F, 0x8F, 0xE0,
-  0xFE, 0xFF, 0xEF, 0xBF, 0x80, 0x0F, 0xE0,
-  0xFE, 0xFF, 0xDF, 0xBF, 0x3F, 0xC7, 0xE0,
-  0xFF, 0x7F, 0xDF, 0xBF, 0x3F, 0xC7, 0xE0,
-  0xFF, 0xBF, 0xBF, 0xBE, 0x7F, 0xE3, 0xE0,
-  0xFF, 0xDF, 0xBF, 0xBC, 0x7F, 0xE1, 0xE0,
-  0xFF, 0xDF, 0xBF, 0xB8, 0x3F, 0x80, 0x60,
-  0xA9,
-  0xA9,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xFF, 0xC7, 0xFF, 0xBE, 0xFF, 0xFF, 0xE0,
-  0xFF, 0xBB, 0xFF, 0xBF, 0xBF, 0xFF, 0xE0,
-  0xFF, 0xB3, 0xFF, 0xBE, 0xEA, 0xFF, 0xE0,
-  0xFF, 0xA9, 0xFF, 0xBF, 0xBC, 0x7F, 0xE0,
-  0xFF, 0x9A, 0x7F, 0xBE, 0xFB, 0xBF, 0xE0,
-  0xFF, 0xBB, 0x1F, 0xBF, 0xF0, 0x1F, 0xE0,
-  0xFF, 0x7B, 0x8F, 0xBF, 0xF7, 0xDF, 0xE0,
-  0xFE, 0xF5, 0xC7, 0xBF, 0xF6, 0x1F, 0xE0,
-  0xFD, 0xFB, 0xC7, 0xBF, 0xF6, 0xDF, 0xE0,
-  0xFB, 0xFF, 0x87, 0xBF, 0xF6, 0x1F, 0xE0,
-  0xFB, 0xFF, 0x47, 0xBF, 0xF6, 0xDF, 0xE0,
-  0xFD, 0xFE, 0xC7, 0xBF, 0xF6, 0x1F, 0xE0,
-  0xFE, 0xFD, 0xC7, 0xBF, 0xF6, 0x1F, 0xE0,
-  0xFF, 0x7B, 0xC7, 0xBF, 0xF7, 0xDF, 0xE0,
-  0xFF, 0xB7, 0xCF, 0xBF, 0xF7, 0xDF, 0xE0,
-  0xFF, 0xCF, 0xDF, 0xBF, 0xF0, 0x1F, 0xE0,
-  0xA9,
-  0xA9,
-  0xA8,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-  0xA7,
-  0xA7,
-  0x00, 0x0E, 0x00, 0x3F, 0xFE, 0x1F, 0xE0,
-  0x00, 0x0A, 0x00, 0x3F, 0xFE, 0xEF, 0xE0,
-  0x00, 0x0E, 0x00, 0x3F, 0xFD, 0xEF, 0xE0,
-  0x00, 0x0E, 0x00, 0x3F, 0xFC, 0xDF, 0xE0,
-  0x00, 0x0E, 0x00, 0x3F, 0xFB, 0x1F, 0xE0,
-  0x00, 0x0E, 0x00, 0x3F, 0xFB, 0xBF, 0xE0,
-  0x00, 0x0E, 0x00, 0x3F, 0xF7, 0xBF, 0xE0,
-  0x00, 0x7F, 0xC0, 0x3F, 0xF7, 0x7F, 0xE0,
-  0x00, 0x40, 0x40, 0x3F, 0xEF, 0x7F, 0xE0,
-  0x00, 0x7F, 0xC0, 0x3F, 0xEE, 0xFF, 0xE0,
-  0x00, 0x40, 0x40, 0x3F, 0xDE, 0xFF, 0xE0,
-  0x00, 0x40, 0x40, 0x3F, 0xDD, 0xFF, 0xE0,
-  0x00, 0x40, 0x40, 0x3F, 0xC3, 0xFF, 0xE0,
-  0x00, 0x55, 0x40, 0x3F, 0xC7, 0xFF, 0xE0,
-  0x00, 0xAA, 0xC0, 0x3F, 0xCF, 0xFF, 0xE0,
-  0x01, 0xFF, 0x80, 0x3F, 0xDF, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-  0xA0,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0x03, 0xE0,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFD, 0xFB, 0xE0,
-  0xF9, 0xFF, 0xFF, 0xBF, 0xFB, 0xF1, 0xE0,
-  0xFE, 0x7F, 0xFF, 0xBF, 0xF7, 0xE9, 0xE0,
-  0xFF, 0x9F, 0xFF, 0xBF, 0xEF, 0xD3, 0xE0,
-  0xFF, 0xE7, 0xFF, 0xBF, 0xDF, 0xA7, 0xE0,
-  0xFF, 0xF9, 0xFF, 0xBF, 0xBF, 0x4F, 0xE0,
-  0xFF, 0xFE, 0x7F, 0xBF, 0x7E, 0x9F, 0xE0,
-  0xFF, 0xFF, 0x9F, 0xBE, 0x01, 0x3F, 0xE0,
-  0xFF, 0xFF, 0xE7, 0xBE, 0xFC, 0x7F, 0xE0,
-  0xFF, 0xFF, 0xFF, 0xBE, 0xFC, 0xFF, 0xE0,
-  0xFF, 0xFF, 0xFF, 0xBE, 0x01, 0xFF, 0xE0,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xF8, 0x00, 0x07, 0xBE, 0x00, 0x01, 0xE0,
-  0xFB, 0xFF, 0xF7, 0xBE, 0x55, 0x55, 0xE0,
-  0xFB, 0xFF, 0xF7, 0xBE, 0xAA, 0xA9, 0xE0,
-  0xA6,
-  0xA7,
-  0xA6,
-  0xA7,
-  0xA6,
-  0xA7,
-  0xA6,
-  0xA5,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xFE, 0x00, 0x1F, 0xBF, 0x80, 0x07, 0xE0,
-  0xFD, 0xFF, 0xEF, 0xBF, 0x55, 0x53, 0xE0,
-  0xA7,
-  0xA6,
-  0xA7,
-  0xA6,
-  0xA7,
-  0xA6,
-  0xA7,
-  0xA1,
-  0xA0,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xFF, 0x80, 0x7F, 0xBF, 0xE0, 0x1F, 0xE0,
-  0xFE, 0x3F, 0x1F, 0xBF, 0x8A, 0x87, 0xE0,
-  0xFC, 0xFF, 0xCF, 0xBF, 0x55, 0x53, 0xE0,
-  0xF9, 0xFF, 0xE7, 0xBE, 0x2A, 0xA9, 0xE0,
-  0xA6,
-  0xA7,
-  0xA6,
-  0xA5,
-  0xFC, 0xFF, 0xCF, 0xBF, 0x15, 0x53, 0xE0,
-  0xA3,
-  0xA2,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA8,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xFF, 0xC0, 0x07, 0xBF, 0xF8, 0x01, 0xE0,
-  0xFF, 0x9F, 0xE7, 0xBF, 0xF2, 0xA9, 0xE0,
-  0xFF, 0x3F, 0xCF, 0xBF, 0xE5, 0x53, 0xE0,
-  0xFE, 0x7F, 0x9F, 0xBF, 0xCA, 0xA7, 0xE0,
-  0xFC, 0xFF, 0x3F, 0xBF, 0x95, 0x4F, 0xE0,
-  0xFD, 0xFE, 0x7F, 0xBF, 0x2A, 0x9F, 0xE0,
-  0xFD, 0xFE, 0x7F, 0xBF, 0x55, 0x1F, 0xE0,
-  0xFD, 0xFF, 0x3F, 0xBF, 0x2A, 0x8F, 0xE0,
-  0xFD, 0xFF, 0x9F, 0xBF, 0x55, 0x47, 0xE0,
-  0xFD, 0xFF, 0xCF, 0xBF, 0x2A, 0xA3, 0xE0,
-  0xFC, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xE0,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-  0xA9,
-}; // 793 bytes
-
-static const uint8_t pFillsData[] PROGMEM =
-{
-  0,72, 1,23, 1,145, 0,33,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0x8F, 0xCF, 0xC9, 0xFD, 0xFD, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFA, 0xFE, 0xFE, 0xBF, 0xBF, 0xBA, 0x3A, 0x3A, 0x3D, 0x7D, 0x79, 0x3D, 0x3D, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0x22, 0x22, 0x08, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x11, 0x11, 0x11, 0xDD, 0xDD, 0xBC, 0xFC, 0xFB, 0xEF, 0xEF, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xBF, 0xBF, 0xBB, 0x77, 0x77, 0x3E, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x22, 0x22, 0x21, 0xDD, 0xDD, 0x9C, 0x9C, 0x9A, 0xFE, 0xFE, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xBF, 0xBB, 0xA3, 0xA3, 0xBE, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x04, 0x44, 0x41, 0xDD, 0xDD, 0x93, 0x93, 0x93, 0xDF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9F, 0x5F, 0x59, 0xC1, 0xC1, 0xAA, 0xAA, 0xA9, 0x01, 0x01, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0xB3, 0xF3, 0xF3, 0xFB, 0xFB, 0x9D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xEF, 0xEF, 0xAE, 0xEE, 0xEA, 0xE2, 0xE2, 0x97, 0xD7, 0xD3, 0xFF, 0xFF, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x22, 0x22, 0x08, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x11, 0x11, 0x11, 0xDD, 0xDD, 0xBF, 0x3F, 0x3B, 0x7F, 0x7F, 0x1D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xF7, 0xF7, 0xB1, 0xB1, 0xB3, 0x77, 0x77, 0x2F, 0xEF, 0xE9, 0x01, 0x01, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x22, 0x22, 0x21, 0xDD, 0xDD, 0xB9, 0x39, 0x3B, 0xF7, 0xF7, 0x9D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAE, 0xEE, 0xEA, 0x2E, 0x2E, 0x2F, 0xEF, 0xE9, 0x01, 0x01, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x04, 0x44, 0x41, 0xDD, 0xDD, 0x89, 0xC9, 0xCB, 0xBF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0x7F, 0x7F, 0x1F, 0x5F, 0x58, 0x1C, 0x1C, 0x2A, 0xAA, 0xA9, 0x3D, 0x3D, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0x8F, 0xCF, 0xC9, 0xFD, 0xFD, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFA, 0xFE, 0xFE, 0xBF, 0xBF, 0xBA, 0x3A, 0x3A, 0x3D, 0x7D, 0x79, 0x3D, 0x3D, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x22, 0x22, 0x08, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x11, 0x11, 0x11, 0xDD, 0xDD, 0xBC, 0xFC, 0xFB, 0xEF, 0xEF, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xBF, 0xBF, 0xBB, 0x77, 0x77, 0x3E, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x22, 0x22, 0x21, 0xDD, 0xDD, 0x9C, 0x9C, 0x9A, 0xFE, 0xFE, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xBF, 0xBB, 0xA3, 0xA3, 0xBE, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x04, 0x44, 0x41, 0xDD, 0xDD, 0x93, 0x93, 0x93, 0xDF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9F, 0x5F, 0x59, 0xC1, 0xC1, 0xAA, 0xAA, 0xA9, 0x01, 0x01, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0xB3, 0xF3, 0xF3, 0xFB, 0xFB, 0x9D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xEF, 0xEF, 0xAE, 0xEE, 0xEA, 0xE2, 0xE2, 0x97, 0xD7, 0xD3, 0xFF, 0xFF, 0x80,
-  0xA5,
-  0xA6,
-  0xA7,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xB7, 0x77, 0x71, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x2E, 0xEE, 0xEB, 0xFF, 0xFF, 0xAF, 0xEF, 0xEB, 0xDF, 0xDF, 0x9F, 0xDF, 0xDB, 0x7F, 0x7F, 0x15, 0x55, 0x53, 0xFF, 0xFF, 0xBF, 0xBF, 0xBA, 0xFA, 0xFA, 0xBE, 0xFE, 0xFB, 0xAF, 0xAF, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9D, 0xDD, 0xDB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDA, 0xFE, 0xFE, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xBF, 0xBB, 0x07, 0x07, 0x3D, 0xFD, 0xFB, 0xDF, 0xDF, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xDF, 0xDF, 0x9D, 0xDD, 0xD9, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x00, 0x00, 0x3F, 0xBF, 0xB9, 0x55, 0x55, 0x00, 0x00, 0x01, 0xFD, 0xFD, 0x9D, 0xDD, 0xDB, 0xEF, 0xEF, 0xBF, 0x3F, 0x3B, 0xDF, 0xDF, 0xBB, 0xFB, 0xFB, 0xFF, 0xFF, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xBF, 0x7F, 0x7B, 0xFF, 0xFF, 0x9F, 0xDF, 0xD8, 0xF8, 0xF8, 0xBA, 0xFA, 0xFB, 0xD7, 0xD7, 0x9E, 0xDE, 0xDB, 0xDF, 0xDF, 0xB7, 0xF7, 0xF3, 0xDF, 0xDF, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xB7, 0x77, 0x71, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x2E, 0xEE, 0xEB, 0xFF, 0xFF, 0xBE, 0xFE, 0xFB, 0xDF, 0xDF, 0x9F, 0xDF, 0xDB, 0x77, 0x77, 0x37, 0x77, 0x73, 0xFF, 0xFF, 0xAD, 0xED, 0xEB, 0xAF, 0xAF, 0xAA, 0xEA, 0xEB, 0xAF, 0xAF, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9D, 0xDD, 0xDB, 0xFF, 0xFF, 0xBD, 0xFD, 0xFB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0x8F, 0x8F, 0xAF, 0xAF, 0xAB, 0xFF, 0xFF, 0xB3, 0xF3, 0xF0, 0x70, 0x70, 0x15, 0x55, 0x53, 0x57, 0x57, 0x00,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xDF, 0xDF, 0x9D, 0xDD, 0xD9, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x00, 0x00, 0x3B, 0xFB, 0xF9, 0xDD, 0xDD, 0x9F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9D, 0xDD, 0xDA, 0xFE, 0xFE, 0xBC, 0xFC, 0xF9, 0xFD, 0xFD, 0x80, 0x00, 0x02, 0xAA, 0xAA, 0x80,
-  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xB7, 0xF7, 0xF3, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0xBF, 0xBF, 0xBF, 0xFF, 0xF9, 0x7D, 0x7D, 0x3F, 0x7F, 0x79, 0xFD, 0xFD, 0xBF, 0x7F, 0x7B, 0x57, 0x57, 0x00,
-  0xA6,
-  0xA7,
-  0xA0,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xBF, 0x7F, 0x7B, 0xFF, 0xFF, 0x9F, 0xDF, 0xD8, 0xF8, 0xF8, 0xBA, 0xFA, 0xFB, 0xD7, 0xD7, 0x9E, 0xDE, 0xDB, 0xDF, 0xDF, 0xB7, 0xF7, 0xF3, 0xDF, 0xDF, 0x80,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xB7, 0x77, 0x71, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x2E, 0xEE, 0xEB, 0xFF, 0xFF, 0xBE, 0xFE, 0xFB, 0xDF, 0xDF, 0x9F, 0xDF, 0xDB, 0x77, 0x77, 0x37, 0x77, 0x73, 0xFF, 0xFF, 0xAD, 0xED, 0xEB, 0xAF, 0xAF, 0xAA, 0xEA, 0xEB, 0xAF, 0xAF, 0x80,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9D, 0xDD, 0xDB, 0xFF, 0xFF, 0xBD, 0xFD, 0xFB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0x8F, 0x8F, 0xAF, 0xAF, 0xAB, 0xFF, 0xFF, 0xB3, 0xF3, 0xF0, 0x70, 0x70, 0x15, 0x55, 0x53, 0x57, 0x57, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xDF, 0xDF, 0x9D, 0xDD, 0xD9, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x00, 0x00, 0x3B, 0xFB, 0xF9, 0xDD, 0xDD, 0x9F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9D, 0xDD, 0xDA, 0xFE, 0xFE, 0xBC, 0xFC, 0xF9, 0xFD, 0xFD, 0x80, 0x00, 0x02, 0xAA, 0xAA, 0x80,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xB7, 0xF7, 0xF3, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0xBF, 0xBF, 0xBF, 0xFF, 0xF9, 0x7D, 0x7D, 0x3F, 0x7F, 0x79, 0xFD, 0xFD, 0xBF, 0x7F, 0x7B, 0x57, 0x57, 0x00,
-}; // 1391 bytes
-
-static const uint8_t pTickData[] PROGMEM =
-{
-  0,13, 0,254, 0,12, 0,9,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
-  0xFF, 0xC0,
-  0xFF, 0x90,
-  0xFF, 0x30,
-  0xFE, 0x70,
-  0x7C, 0xF0,
-  0x39, 0xF0,
-  0x93, 0xF0,
-  0xC7, 0xF0,
-  0xEF, 0xF0,
-}; // 26 bytes
-
-// (created from "Icon.png")
-static const uint8_t pIconImage[] PROGMEM =
-{
-  0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x02, 0x80, 0x00, 
-  0x00, 0x04, 0x40, 0x00, 
-  0x00, 0x08, 0x20, 0x00, 
-  0x00, 0x10, 0x70, 0x00, 
-  0x00, 0x20, 0xF8, 0x00, 
-  0x00, 0x41, 0xFC, 0x00, 
-  0x00, 0x83, 0xFA, 0x00, 
-  0x01, 0x02, 0xF1, 0x00, 
-  0x02, 0x05, 0xE0, 0x80, 
-  0x04, 0x09, 0xC0, 0x40, 
-  0x08, 0x02, 0x80, 0x20, 
-  0x10, 0x01, 0x00, 0x10, 
-  0x20, 0x02, 0x00, 0x08, 
-  0x40, 0x00, 0x3F, 0x04, 
-  0x80, 0x08, 0x40, 0x82, 
-  0x40, 0x10, 0x80, 0x41, 
-  0x20, 0x31, 0x30, 0x22, 
-  0x10, 0x39, 0xC8, 0x14, 
-  0x08, 0x1E, 0x7F, 0x8F, 
-  0x04, 0x02, 0x30, 0x07, 
-  0x02, 0x01, 0x00, 0x07, 
-  0x01, 0x00, 0x80, 0x07, 
-  0x00, 0x80, 0x60, 0x07, 
-  0x00, 0x40, 0x1F, 0xE7, 
-  0x00, 0x20, 0x02, 0x1F, 
-  0x00, 0x10, 0x04, 0x07, 
-  0x00, 0x08, 0x08, 0x00, 
-  0x00, 0x04, 0x10, 0x00, 
-  0x00, 0x02, 0x20, 0x00, 
-  0x00, 0x01, 0x40, 0x00, 
-  0x00, 0x00, 0x80, 0x00, 
-}; // 128 bytes
-
-// (created from "Busy.png")
-static const uint8_t pBusyImage[] PROGMEM =
-{
-  0x07, 0xE0, 
-  0xA0,
-  0xA0,
-  0xA0,
-  0x08, 0x10, 
-  0x10, 0x88, 
-  0xA2,
-  0x10, 0x8C, 
-  0x13, 0x8C, 
-  0x10, 0x08, 
-  0xA5,
-  0xA1,
-  0xA0,
-  0xA0,
-  0xA0,
-  0xA0,
-}; // 22 bytes
-
-// (created from "Disk.png")
-static const uint8_t pDiskImage[] PROGMEM =
-{
-  0x7F, 0xF8, 
-  0x88, 0x14, 
-  0x88, 0xD2, 
-  0x88, 0xD1, 
-  0x88, 0x11, 
-  0x87, 0xE1, 
-  0x80, 0x01, 
-  0xA6,
-  0x8F, 0xF1, 
-  0x90, 0x09, 
-  0xA0,
-  0xA0,
-  0xA0,
-  0xA0,
-  0xA0,
-  0x7F, 0xFE, 
-}; // 26 bytes
-
-// total 2386 bytes
+// (created from "MacPaint 480x320.png" by encode_graphics.py)
+// duplicate row encoding:
+#define BMP_ROW_ESC_MASK        0b11110000 // mask for escape byte
+#define BMP_ROW_ESC_VALUE       0b10100000 // escape byte
+#define BMP_ROW_ESC_IDX         0b00001111 // index to recent or initial
+#define BMP_ROW_ESC_IDX_BLACK   0b00001000 // index to black row
+
+static const uint8_t pToolsData[] PROGMEM =
+{
+  0,10, 0,29, 0,51, 0,197,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
+  0xA0,
+  0xA0,
+  0xA0,
+  0xFF, 0xE0, 0x3F, 0xBE, 0x18, 0x31, 0xE0,
+  0xFF, 0x1F, 0xCF, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xFE, 0xFF, 0xF7, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xFD, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xE0,
+  0xFB, 0xFF, 0xF7, 0xBF, 0xFF, 0xFF, 0xE0,
+  0xFB, 0xFF, 0xCF, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xFB, 0xFE, 0x3F, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xFC, 0x71, 0xFF, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xF9, 0x8F, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
+  0xFA, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
+  0xFC, 0x7F, 0xFF, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xFF, 0x7F, 0xFF, 0xBE, 0xFF, 0xFD, 0xE0,
+  0xFF, 0x7F, 0xFF, 0xBE, 0x30, 0x61, 0xE0,
+  0xFE, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xE0,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xFF, 0xF3, 0xFF, 0xBF, 0xFD, 0xFF, 0xE0,
+  0xFF, 0x2C, 0x7F, 0xBF, 0xF8, 0xFF, 0xE0,
+  0xFE, 0xCD, 0xBF, 0xBF, 0xF8, 0xFF, 0xE0,
+  0xFE, 0xCD, 0xAF, 0xBF, 0xF0, 0x7F, 0xE0,
+  0xFF, 0x6D, 0x97, 0xBF, 0xF4, 0x7F, 0xE0,
+  0xFF, 0x6D, 0xB7, 0xBF, 0xE6, 0x3F, 0xE0,
+  0xFC, 0xBF, 0xB7, 0xBF, 0xEE, 0x3F, 0xE0,
+  0xFB, 0x3F, 0xF7, 0xBF, 0xCF, 0x1F, 0xE0,
+  0xFB, 0xBF, 0xEF, 0xBF, 0xDF, 0x1F, 0xE0,
+  0xFD, 0xFF, 0xEF, 0xBF, 0x9F, 0x8F, 0xE0,
+  0xFE, 0xFF, 0xEF, 0xBF, 0x80, 0x0F, 0xE0,
+  0xFE, 0xFF, 0xDF, 0xBF, 0x3F, 0xC7, 0xE0,
+  0xFF, 0x7F, 0xDF, 0xBF, 0x3F, 0xC7, 0xE0,
+  0xFF, 0xBF, 0xBF, 0xBE, 0x7F, 0xE3, 0xE0,
+  0xFF, 0xDF, 0xBF, 0xBC, 0x7F, 0xE1, 0xE0,
+  0xFF, 0xDF, 0xBF, 0xB8, 0x3F, 0x80, 0x60,
+  0xA9,
+  0xA9,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xFF, 0xC7, 0xFF, 0xBE, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xBB, 0xFF, 0xBF, 0xBF, 0xFF, 0xE0,
+  0xFF, 0xB3, 0xFF, 0xBE, 0xEA, 0xFF, 0xE0,
+  0xFF, 0xA9, 0xFF, 0xBF, 0xBC, 0x7F, 0xE0,
+  0xFF, 0x9A, 0x7F, 0xBE, 0xFB, 0xBF, 0xE0,
+  0xFF, 0xBB, 0x1F, 0xBF, 0xF0, 0x1F, 0xE0,
+  0xFF, 0x7B, 0x8F, 0xBF, 0xF7, 0xDF, 0xE0,
+  0xFE, 0xF5, 0xC7, 0xBF, 0xF6, 0x1F, 0xE0,
+  0xFD, 0xFB, 0xC7, 0xBF, 0xF6, 0xDF, 0xE0,
+  0xFB, 0xFF, 0x87, 0xBF, 0xF6, 0x1F, 0xE0,
+  0xFB, 0xFF, 0x47, 0xBF, 0xF6, 0xDF, 0xE0,
+  0xFD, 0xFE, 0xC7, 0xBF, 0xF6, 0x1F, 0xE0,
+  0xFE, 0xFD, 0xC7, 0xBF, 0xF6, 0x1F, 0xE0,
+  0xFF, 0x7B, 0xC7, 0xBF, 0xF7, 0xDF, 0xE0,
+  0xFF, 0xB7, 0xCF, 0xBF, 0xF7, 0xDF, 0xE0,
+  0xFF, 0xCF, 0xDF, 0xBF, 0xF0, 0x1F, 0xE0,
+  0xA9,
+  0xA9,
+  0xA8,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
+  0xA7,
+  0xA7,
+  0x00, 0x0E, 0x00, 0x3F, 0xFE, 0x1F, 0xE0,
+  0x00, 0x0A, 0x00, 0x3F, 0xFE, 0xEF, 0xE0,
+  0x00, 0x0E, 0x00, 0x3F, 0xFD, 0xEF, 0xE0,
+  0x00, 0x0E, 0x00, 0x3F, 0xFC, 0xDF, 0xE0,
+  0x00, 0x0E, 0x00, 0x3F, 0xFB, 0x1F, 0xE0,
+  0x00, 0x0E, 0x00, 0x3F, 0xFB, 0xBF, 0xE0,
+  0x00, 0x0E, 0x00, 0x3F, 0xF7, 0xBF, 0xE0,
+  0x00, 0x7F, 0xC0, 0x3F, 0xF7, 0x7F, 0xE0,
+  0x00, 0x40, 0x40, 0x3F, 0xEF, 0x7F, 0xE0,
+  0x00, 0x7F, 0xC0, 0x3F, 0xEE, 0xFF, 0xE0,
+  0x00, 0x40, 0x40, 0x3F, 0xDE, 0xFF, 0xE0,
+  0x00, 0x40, 0x40, 0x3F, 0xDD, 0xFF, 0xE0,
+  0x00, 0x40, 0x40, 0x3F, 0xC3, 0xFF, 0xE0,
+  0x00, 0x55, 0x40, 0x3F, 0xC7, 0xFF, 0xE0,
+  0x00, 0xAA, 0xC0, 0x3F, 0xCF, 0xFF, 0xE0,
+  0x01, 0xFF, 0x80, 0x3F, 0xDF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
+  0xA0,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0x03, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xBF, 0xFD, 0xFB, 0xE0,
+  0xF9, 0xFF, 0xFF, 0xBF, 0xFB, 0xF1, 0xE0,
+  0xFE, 0x7F, 0xFF, 0xBF, 0xF7, 0xE9, 0xE0,
+  0xFF, 0x9F, 0xFF, 0xBF, 0xEF, 0xD3, 0xE0,
+  0xFF, 0xE7, 0xFF, 0xBF, 0xDF, 0xA7, 0xE0,
+  0xFF, 0xF9, 0xFF, 0xBF, 0xBF, 0x4F, 0xE0,
+  0xFF, 0xFE, 0x7F, 0xBF, 0x7E, 0x9F, 0xE0,
+  0xFF, 0xFF, 0x9F, 0xBE, 0x01, 0x3F, 0xE0,
+  0xFF, 0xFF, 0xE7, 0xBE, 0xFC, 0x7F, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xBE, 0xFC, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xBE, 0x01, 0xFF, 0xE0,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xF8, 0x00, 0x07, 0xBE, 0x00, 0x01, 0xE0,
+  0xFB, 0xFF, 0xF7, 0xBE, 0x55, 0x55, 0xE0,
+  0xFB, 0xFF, 0xF7, 0xBE, 0xAA, 0xA9, 0xE0,
+  0xA6,
+  0xA7,
+  0xA6,
+  0xA7,
+  0xA6,
+  0xA7,
+  0xA6,
+  0xA5,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xFE, 0x00, 0x1F, 0xBF, 0x80, 0x07, 0xE0,
+  0xFD, 0xFF, 0xEF, 0xBF, 0x55, 0x53, 0xE0,
+  0xA7,
+  0xA6,
+  0xA7,
+  0xA6,
+  0xA7,
+  0xA6,
+  0xA7,
+  0xA1,
+  0xA0,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xFF, 0x80, 0x7F, 0xBF, 0xE0, 0x1F, 0xE0,
+  0xFE, 0x3F, 0x1F, 0xBF, 0x8A, 0x87, 0xE0,
+  0xFC, 0xFF, 0xCF, 0xBF, 0x55, 0x53, 0xE0,
+  0xF9, 0xFF, 0xE7, 0xBE, 0x2A, 0xA9, 0xE0,
+  0xA6,
+  0xA7,
+  0xA6,
+  0xA5,
+  0xFC, 0xFF, 0xCF, 0xBF, 0x15, 0x53, 0xE0,
+  0xA3,
+  0xA2,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA8,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xFF, 0xC0, 0x07, 0xBF, 0xF8, 0x01, 0xE0,
+  0xFF, 0x9F, 0xE7, 0xBF, 0xF2, 0xA9, 0xE0,
+  0xFF, 0x3F, 0xCF, 0xBF, 0xE5, 0x53, 0xE0,
+  0xFE, 0x7F, 0x9F, 0xBF, 0xCA, 0xA7, 0xE0,
+  0xFC, 0xFF, 0x3F, 0xBF, 0x95, 0x4F, 0xE0,
+  0xFD, 0xFE, 0x7F, 0xBF, 0x2A, 0x9F, 0xE0,
+  0xFD, 0xFE, 0x7F, 0xBF, 0x55, 0x1F, 0xE0,
+  0xFD, 0xFF, 0x3F, 0xBF, 0x2A, 0x8F, 0xE0,
+  0xFD, 0xFF, 0x9F, 0xBF, 0x55, 0x47, 0xE0,
+  0xFD, 0xFF, 0xCF, 0xBF, 0x2A, 0xA3, 0xE0,
+  0xFC, 0x00, 0x0F, 0xBF, 0x00, 0x03, 0xE0,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+  0xA9,
+}; // 793 bytes
+
+static const uint8_t pFillsData[] PROGMEM =
+{
+  0,72, 1,23, 1,145, 0,33,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0x8F, 0xCF, 0xC9, 0xFD, 0xFD, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFA, 0xFE, 0xFE, 0xBF, 0xBF, 0xBA, 0x3A, 0x3A, 0x3D, 0x7D, 0x79, 0x3D, 0x3D, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0x22, 0x22, 0x08, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x11, 0x11, 0x11, 0xDD, 0xDD, 0xBC, 0xFC, 0xFB, 0xEF, 0xEF, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xBF, 0xBF, 0xBB, 0x77, 0x77, 0x3E, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x22, 0x22, 0x21, 0xDD, 0xDD, 0x9C, 0x9C, 0x9A, 0xFE, 0xFE, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xBF, 0xBB, 0xA3, 0xA3, 0xBE, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x04, 0x44, 0x41, 0xDD, 0xDD, 0x93, 0x93, 0x93, 0xDF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9F, 0x5F, 0x59, 0xC1, 0xC1, 0xAA, 0xAA, 0xA9, 0x01, 0x01, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0xB3, 0xF3, 0xF3, 0xFB, 0xFB, 0x9D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xEF, 0xEF, 0xAE, 0xEE, 0xEA, 0xE2, 0xE2, 0x97, 0xD7, 0xD3, 0xFF, 0xFF, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x22, 0x22, 0x08, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x11, 0x11, 0x11, 0xDD, 0xDD, 0xBF, 0x3F, 0x3B, 0x7F, 0x7F, 0x1D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xF7, 0xF7, 0xB1, 0xB1, 0xB3, 0x77, 0x77, 0x2F, 0xEF, 0xE9, 0x01, 0x01, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x22, 0x22, 0x21, 0xDD, 0xDD, 0xB9, 0x39, 0x3B, 0xF7, 0xF7, 0x9D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xAE, 0xEE, 0xEA, 0x2E, 0x2E, 0x2F, 0xEF, 0xE9, 0x01, 0x01, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x04, 0x44, 0x41, 0xDD, 0xDD, 0x89, 0xC9, 0xCB, 0xBF, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0x7F, 0x7F, 0x1F, 0x5F, 0x58, 0x1C, 0x1C, 0x2A, 0xAA, 0xA9, 0x3D, 0x3D, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0x8F, 0xCF, 0xC9, 0xFD, 0xFD, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFA, 0xFE, 0xFE, 0xBF, 0xBF, 0xBA, 0x3A, 0x3A, 0x3D, 0x7D, 0x79, 0x3D, 0x3D, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x02, 0x22, 0x22, 0x08, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x11, 0x11, 0x11, 0xDD, 0xDD, 0xBC, 0xFC, 0xFB, 0xEF, 0xEF, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xBF, 0xBF, 0xBB, 0x77, 0x77, 0x3E, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x22, 0x22, 0x21, 0xDD, 0xDD, 0x9C, 0x9C, 0x9A, 0xFE, 0xFE, 0x9D, 0xDD, 0xD9, 0xFD, 0xFD, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xBF, 0xBB, 0xA3, 0xA3, 0xBE, 0xFE, 0xF9, 0x3D, 0x3D, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x89, 0x55, 0x55, 0x2A, 0xAA, 0xA9, 0x55, 0x55, 0x04, 0x44, 0x41, 0xDD, 0xDD, 0x93, 0x93, 0x93, 0xDF, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9F, 0x5F, 0x59, 0xC1, 0xC1, 0xAA, 0xAA, 0xA9, 0x01, 0x01, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0x55, 0x55, 0x08, 0x88, 0x89, 0xDD, 0xDD, 0xB3, 0xF3, 0xF3, 0xFB, 0xFB, 0x9D, 0xDD, 0xDB, 0xDF, 0xDF, 0xBF, 0xFF, 0xFB, 0xEF, 0xEF, 0xAE, 0xEE, 0xEA, 0xE2, 0xE2, 0x97, 0xD7, 0xD3, 0xFF, 0xFF, 0x80,
+  0xA5,
+  0xA6,
+  0xA7,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xB7, 0x77, 0x71, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x2E, 0xEE, 0xEB, 0xFF, 0xFF, 0xAF, 0xEF, 0xEB, 0xDF, 0xDF, 0x9F, 0xDF, 0xDB, 0x7F, 0x7F, 0x15, 0x55, 0x53, 0xFF, 0xFF, 0xBF, 0xBF, 0xBA, 0xFA, 0xFA, 0xBE, 0xFE, 0xFB, 0xAF, 0xAF, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9D, 0xDD, 0xDB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDA, 0xFE, 0xFE, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xBF, 0xBB, 0x07, 0x07, 0x3D, 0xFD, 0xFB, 0xDF, 0xDF, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xDF, 0xDF, 0x9D, 0xDD, 0xD9, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x00, 0x00, 0x3F, 0xBF, 0xB9, 0x55, 0x55, 0x00, 0x00, 0x01, 0xFD, 0xFD, 0x9D, 0xDD, 0xDB, 0xEF, 0xEF, 0xBF, 0x3F, 0x3B, 0xDF, 0xDF, 0xBB, 0xFB, 0xFB, 0xFF, 0xFF, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xBF, 0x7F, 0x7B, 0xFF, 0xFF, 0x9F, 0xDF, 0xD8, 0xF8, 0xF8, 0xBA, 0xFA, 0xFB, 0xD7, 0xD7, 0x9E, 0xDE, 0xDB, 0xDF, 0xDF, 0xB7, 0xF7, 0xF3, 0xDF, 0xDF, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xB7, 0x77, 0x71, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x2E, 0xEE, 0xEB, 0xFF, 0xFF, 0xBE, 0xFE, 0xFB, 0xDF, 0xDF, 0x9F, 0xDF, 0xDB, 0x77, 0x77, 0x37, 0x77, 0x73, 0xFF, 0xFF, 0xAD, 0xED, 0xEB, 0xAF, 0xAF, 0xAA, 0xEA, 0xEB, 0xAF, 0xAF, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9D, 0xDD, 0xDB, 0xFF, 0xFF, 0xBD, 0xFD, 0xFB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0x8F, 0x8F, 0xAF, 0xAF, 0xAB, 0xFF, 0xFF, 0xB3, 0xF3, 0xF0, 0x70, 0x70, 0x15, 0x55, 0x53, 0x57, 0x57, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xDF, 0xDF, 0x9D, 0xDD, 0xD9, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x00, 0x00, 0x3B, 0xFB, 0xF9, 0xDD, 0xDD, 0x9F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9D, 0xDD, 0xDA, 0xFE, 0xFE, 0xBC, 0xFC, 0xF9, 0xFD, 0xFD, 0x80, 0x00, 0x02, 0xAA, 0xAA, 0x80,
+  0xFE, 0x00, 0x00, 0x00, 0x1F, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xB7, 0xF7, 0xF3, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0xBF, 0xBF, 0xBF, 0xFF, 0xF9, 0x7D, 0x7D, 0x3F, 0x7F, 0x79, 0xFD, 0xFD, 0xBF, 0x7F, 0x7B, 0x57, 0x57, 0x00,
+  0xA6,
+  0xA7,
+  0xA0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xBF, 0x7F, 0x7B, 0xFF, 0xFF, 0x9F, 0xDF, 0xD8, 0xF8, 0xF8, 0xBA, 0xFA, 0xFB, 0xD7, 0xD7, 0x9E, 0xDE, 0xDB, 0xDF, 0xDF, 0xB7, 0xF7, 0xF3, 0xDF, 0xDF, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xF9, 0xFD, 0xFD, 0xB7, 0x77, 0x71, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x2E, 0xEE, 0xEB, 0xFF, 0xFF, 0xBE, 0xFE, 0xFB, 0xDF, 0xDF, 0x9F, 0xDF, 0xDB, 0x77, 0x77, 0x37, 0x77, 0x73, 0xFF, 0xFF, 0xAD, 0xED, 0xEB, 0xAF, 0xAF, 0xAA, 0xEA, 0xEB, 0xAF, 0xAF, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0x9D, 0xDD, 0xDB, 0xFF, 0xFF, 0xBD, 0xFD, 0xFB, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0x8F, 0x8F, 0xAF, 0xAF, 0xAB, 0xFF, 0xFF, 0xB3, 0xF3, 0xF0, 0x70, 0x70, 0x15, 0x55, 0x53, 0x57, 0x57, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xDF, 0xDF, 0x9D, 0xDD, 0xD9, 0xDD, 0xDD, 0x95, 0x55, 0x50, 0x00, 0x00, 0x3B, 0xBB, 0xB8, 0x00, 0x00, 0x3B, 0xFB, 0xF9, 0xDD, 0xDD, 0x9F, 0xDF, 0xDB, 0xDF, 0xDF, 0x9D, 0xDD, 0xDA, 0xFE, 0xFE, 0xBC, 0xFC, 0xF9, 0xFD, 0xFD, 0x80, 0x00, 0x02, 0xAA, 0xAA, 0x80,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x3F, 0xFF, 0xFB, 0xFF, 0xFF, 0xB7, 0x77, 0x73, 0xFF, 0xFF, 0xB7, 0xF7, 0xF3, 0xFF, 0xFF, 0x9F, 0xDF, 0xDB, 0xBF, 0xBF, 0xBF, 0xFF, 0xF9, 0x7D, 0x7D, 0x3F, 0x7F, 0x79, 0xFD, 0xFD, 0xBF, 0x7F, 0x7B, 0x57, 0x57, 0x00,
+}; // 1391 bytes
+
+static const uint8_t pTickData[] PROGMEM =
+{
+  0,13, 0,254, 0,12, 0,9,  // xHi,xLo, yHi,yLo, wHi,wLo, hHi,hLo,
+  0xFF, 0xC0,
+  0xFF, 0x90,
+  0xFF, 0x30,
+  0xFE, 0x70,
+  0x7C, 0xF0,
+  0x39, 0xF0,
+  0x93, 0xF0,
+  0xC7, 0xF0,
+  0xEF, 0xF0,
+}; // 26 bytes
+
+// (created from "Icon.png")
+static const uint8_t pIconImage[] PROGMEM =
+{
+  0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x02, 0x80, 0x00, 
+  0x00, 0x04, 0x40, 0x00, 
+  0x00, 0x08, 0x20, 0x00, 
+  0x00, 0x10, 0x70, 0x00, 
+  0x00, 0x20, 0xF8, 0x00, 
+  0x00, 0x41, 0xFC, 0x00, 
+  0x00, 0x83, 0xFA, 0x00, 
+  0x01, 0x02, 0xF1, 0x00, 
+  0x02, 0x05, 0xE0, 0x80, 
+  0x04, 0x09, 0xC0, 0x40, 
+  0x08, 0x02, 0x80, 0x20, 
+  0x10, 0x01, 0x00, 0x10, 
+  0x20, 0x02, 0x00, 0x08, 
+  0x40, 0x00, 0x3F, 0x04, 
+  0x80, 0x08, 0x40, 0x82, 
+  0x40, 0x10, 0x80, 0x41, 
+  0x20, 0x31, 0x30, 0x22, 
+  0x10, 0x39, 0xC8, 0x14, 
+  0x08, 0x1E, 0x7F, 0x8F, 
+  0x04, 0x02, 0x30, 0x07, 
+  0x02, 0x01, 0x00, 0x07, 
+  0x01, 0x00, 0x80, 0x07, 
+  0x00, 0x80, 0x60, 0x07, 
+  0x00, 0x40, 0x1F, 0xE7, 
+  0x00, 0x20, 0x02, 0x1F, 
+  0x00, 0x10, 0x04, 0x07, 
+  0x00, 0x08, 0x08, 0x00, 
+  0x00, 0x04, 0x10, 0x00, 
+  0x00, 0x02, 0x20, 0x00, 
+  0x00, 0x01, 0x40, 0x00, 
+  0x00, 0x00, 0x80, 0x00, 
+}; // 128 bytes
+
+// (created from "Busy.png")
+static const uint8_t pBusyImage[] PROGMEM =
+{
+  0x07, 0xE0, 
+  0xA0,
+  0xA0,
+  0xA0,
+  0x08, 0x10, 
+  0x10, 0x88, 
+  0xA2,
+  0x10, 0x8C, 
+  0x13, 0x8C, 
+  0x10, 0x08, 
+  0xA5,
+  0xA1,
+  0xA0,
+  0xA0,
+  0xA0,
+  0xA0,
+}; // 22 bytes
+
+// (created from "Disk.png")
+static const uint8_t pDiskImage[] PROGMEM =
+{
+  0x7F, 0xF8, 
+  0x88, 0x14, 
+  0x88, 0xD2, 
+  0x88, 0xD1, 
+  0x88, 0x11, 
+  0x87, 0xE1, 
+  0x80, 0x01, 
+  0xA6,
+  0x8F, 0xF1, 
+  0x90, 0x09, 
+  0xA0,
+  0xA0,
+  0xA0,
+  0xA0,
+  0xA0,
+  0x7F, 0xFE, 
+}; // 26 bytes
+
+// total 2386 bytes
@@ -0,0 +1,230 @@
+#include <Arduino.h>
+#include "Config.h"
+#include "LCD.h"
+#include "Slides.h"
+#include "Ingest.h"
+
+#ifdef CFG_SERIAL_INGEST
+// Runs are painted straight into an LCD window as they arrive. The window is opened again
+// on each Poll() (from where the slide got to) as the App may have drawn in between.
+namespace Ingest
+{
+  const uint32_t kTimeoutMS = 2000; // a slide is abandoned if the host goes quiet
+
+  enum State { kSync1, kSync2, kType, kLength, kPayload, kSum };
+  uint8_t state = kSync1;
+  uint8_t type = 0;
+  uint8_t length = 0;
+  uint8_t got = 0;
+  uint8_t sum = 0;
+  uint8_t payload[INGEST_MAX_PAYLOAD];
+  uint8_t unacknowledged = 0;
+  uint32_t lastByteMS = 0;
+
+  // the slide being received
+  bool receiving = false;
+  char name[SLIDE_APPENDED_TEXT_MAX_LEN + 1];
+  uint16_t slideX = 0;
+  uint16_t slideY = 0;
+  uint16_t slideW = 0;
+  uint16_t slideH = 0;
+  uint32_t done = 0;      // pixels painted
+  uint32_t inWindow = 0;  // pixels left in the open LCD window, 0 if it's not open
+  bool longRun = false;   // a run's count is in the next byte
+  uint8_t runLevel = 0;
+
+  void Begin()
+  {
+    // start listening
+    Serial.begin(CFG_SERIAL_INGEST);
+  }
+
+  bool Receiving()
+  {
+    // true while a slide is arriving
+    return receiving;
+  }
+
+  void OpenWindow()
+  {
+    // open a window from where the slide got to, the rest of the row if it's part way through one
+    uint16_t row = done / slideW;
+    uint16_t col = done % slideW;
+    if (col)
+    {
+      LCD_BEGIN_FILL(slideX + col, slideY + row, slideW - col, 1);
+      inWindow = slideW - col;
+    }
+    else
+    {
+      LCD_BEGIN_FILL(slideX, slideY + row, slideW, slideH - row);
+      inWindow = (uint32_t)slideW * (slideH - row);
+    }
+  }
+
+  void Fill(uint16_t n, uint8_t level)
+  {
+    // paint the next n pixels of a grey level 0..15, ignoring any past the end
+    while (n && done < (uint32_t)slideW * slideH)
+    {
+      if (!inWindow)
+        OpenWindow();
+      uint16_t fill = (n < inWindow)?n:inWindow;
+      LCD_FILL_COLOUR(fill, Slides::LevelColour(level));
+      n -= fill;
+      inWindow -= fill;
+      done += fill;
+    }
+  }
+
+  void Runs()
+  {
+    // paint the runs in the payload
+    for (uint8_t b = 0; b < length; b++)
+    {
+      uint8_t run = payload[b];
+      if (longRun)
+      {
+        Fill(run, runLevel);
+        longRun = false;
+      }
+      else if (run & 0x0F)
+        Fill(run & 0x0F, run >> 4);
+      else
+      {
+        runLevel = run >> 4;
+        longRun = true;
+      }
+    }
+  }
+
+  bool Start(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+  {
+    // start the slide in the payload centred in the window x, y, w, h, filling the gaps around it
+    // false if it isn't valid
+    if (length < 4)
+      return false;
+    slideW = payload[0] | (payload[1] << 8);
+    slideH = payload[2] | (payload[3] << 8);
+    if (!slideW || !slideH || slideW > w || slideH > h)
+      return false;
+    uint8_t len = length - 4;
+    if (len > SLIDE_APPENDED_TEXT_MAX_LEN)
+      len = SLIDE_APPENDED_TEXT_MAX_LEN;
+    memcpy(name, payload + 4, len);
+    name[len] = '\0';
+    slideX = x + (w - slideW) / 2;
+    slideY = y + (h - slideH) / 2;
+    Slides::Invalidate();
+    if (slideX > x)
+      LCD_FILL_RECT(x, y, slideX - x, h, CFG_GAP_FILL_COLOUR); // left
+    if (slideX + slideW < x + w)
+      LCD_FILL_RECT(slideX + slideW, y, x + w - slideX - slideW, h, CFG_GAP_FILL_COLOUR); // right
+    if (slideY > y)
+      LCD_FILL_RECT(slideX, y, slideW, slideY - y, CFG_GAP_FILL_COLOUR); // top
+    if (slideY + slideH < y + h)
+      LCD_FILL_RECT(slideX, slideY + slideH, slideW, y + h - slideY - slideH, CFG_GAP_FILL_COLOUR); // bottom
+    done = 0;
+    inWindow = 0;
+    longRun = false;
+    return true;
+  }
+
+  uint8_t Frame(uint16_t x, uint16_t y, uint16_t w, uint16_t h, char* pName)
+  {
+    // act on a complete, valid, frame
+    switch (type)
+    {
+      case INGEST_HELLO:
+        unacknowledged = 0;
+        receiving = false;
+        Serial.write(INGEST_READY);
+        break;
+      case INGEST_START:
+        receiving = Start(x, y, w, h);
+        if (!receiving)
+          Serial.write(INGEST_NAK);
+        return receiving?INGEST_BEGUN:INGEST_NONE;
+      case INGEST_RUNS:
+        if (receiving)
+          Runs();
+        break;
+      case INGEST_END:
+        // all that was sent has been read, the host can start the next slide with full credit
+        unacknowledged = 0;
+        Serial.write(INGEST_READY);
+        if (receiving)
+        {
+          receiving = false;
+          strcpy(pName, name);
+          return INGEST_ENDED;
+        }
+        break;
+    }
+    return INGEST_NONE;
+  }
+
+  uint8_t Poll(uint16_t x, uint16_t y, uint16_t w, uint16_t h, char* pName)
+  {
+    // read what has arrived, painting a slide into the window x, y, w, h
+    // returns INGEST_BEGUN when a slide starts or INGEST_ENDED when it is complete (pName is its name)
+    uint8_t result = INGEST_NONE;
+    inWindow = 0;
+    if (receiving && millis() - lastByteMS > kTimeoutMS)
+      receiving = false;
+    while (result == INGEST_NONE && Serial.available())
+    {
+      uint8_t b = Serial.read();
+      lastByteMS = millis();
+      if (++unacknowledged == INGEST_CREDIT_STEP)
+      {
+        Serial.write(INGEST_ACK);
+        unacknowledged = 0;
+      }
+      switch (state)
+      {
+        case kSync1:
+          if (b == INGEST_SYNC1)
+            state = kSync2;
+          break;
+        case kSync2:
+          state = (b == INGEST_SYNC2)?kType:kSync1;
+          break;
+        case kType:
+          type = sum = b;
+          state = kLength;
+          break;
+        case kLength:
+          length = b;
+          sum += b;
+          got = 0;
+          state = length?kPayload:kSum;
+          if (length > INGEST_MAX_PAYLOAD)
+          {
+            state = kSync1;
+            receiving = false;
+            Serial.write(INGEST_NAK);
+          }
+          break;
+        case kPayload:
+          payload[got++] = b;
+          sum += b;
+          if (got == length)
+            state = kSum;
+          break;
+        case kSum:
+          state = kSync1;
+          if (b == sum)
+            result = Frame(x, y, w, h, pName);
+          else
+          {
+            receiving = false;
+            Serial.write(INGEST_NAK);
+          }
+          break;
+      }
+    }
+    return result;
+  }
+};
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+
+// Slides streamed over Serial, see CFG_SERIAL_INGEST and resources/stream_slides.py
+// Frames from the host are
+//  INGEST_SYNC1 INGEST_SYNC2 <type> <length> <length bytes of payload> <sum>
+// where sum is the low byte of the sum of type, length and the payload.
+#define INGEST_SYNC1        'L'
+#define INGEST_SYNC2        'P'
+#define INGEST_MAX_PAYLOAD  56  // so a whole frame fits in the Uno's 64 byte Serial buffer
+// Frame types:
+#define INGEST_HELLO        'H' // (re)start, no payload. Answered with INGEST_READY
+#define INGEST_START        'S' // a slide: <width lo, hi> <height lo, hi> <name>. Centred in the window, must fit
+#define INGEST_RUNS         'R' // runs of pixels, left to right, top-down: <level:4,count:4>,
+                                // count 0 means the count is in the next byte (as in the slide cache)
+#define INGEST_END          'E' // the slide is complete, no payload. Answered with INGEST_READY
+// Replies to the host:
+#define INGEST_READY        'R' // after INGEST_HELLO or INGEST_END, the host has INGEST_CREDIT bytes of credit
+                                // (so the last < INGEST_CREDIT_STEP bytes of a slide don't leave it short)
+#define INGEST_ACK          '+' // another INGEST_CREDIT_STEP bytes of credit
+#define INGEST_NAK          '!' // a bad frame, the host should start the slide again
+// Flow control: the host never has more than INGEST_CREDIT bytes unacknowledged
+#define INGEST_CREDIT       64
+#define INGEST_CREDIT_STEP  32
+// What Poll() did
+#define INGEST_NONE         0
+#define INGEST_BEGUN        1 // a slide started
+#define INGEST_ENDED        2 // a slide is complete
+
+namespace Ingest
+{
+  void Begin();
+  uint8_t Poll(uint16_t x, uint16_t y, uint16_t w, uint16_t h, char* pName);
+  bool Receiving();
+};
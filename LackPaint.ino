@@ -1,123 +1,160 @@
-#include <SPI.h>
-// These two compile with warnings
-#include <SD.h> // v1.3.0
-// External libraries
-#include <MCUFRIEND_kbv.h> // v3.0.0
-
-#include "Config.h"
-#include "LCD.h"
-#include "App.h"
-
-//  L a c k P a i n t
-//
-// What:
-//  A photoframe in the style of v1.0 of MacPaint (1981) (https://en.wikipedia.org/wiki/MacPaint)
-//  It uses a Arduino Uno and 480x320 LCD shield with built-in SD card support.  
-//  Files are loaded from a directory on a MicroSD card on the LCD shield and displayed 
-//  sequentially or randomly.
-//  The images on the card MUST be
-//    * uncompressed bitmaps (.BMP), and either
-//    * monochrome (1 bit-per-pixel) OR
-//    * 4-bit greyscale.
-//    * sized to fit the display window's width (396 pixels) and/or height (218 pixels).
-//  By default they are pulled from the SLIDES folder in the SD card (but see CFG_IMAGE_FOLDER).
-//   
-//  The look is based closely on the original MacPaint but adjusted to work with the LCD's aspect
-//  ratio.  I have reduced the original's dimensions by removing 
-//    * a column of fill styles (second from right) and 
-//    * a row of tools (second from bottom)
-//  Refer to the "resources" subdirectory: 
-//    * "MacPaint Original.png" is the reference image,
-//    * "MacPaint 480x320.png" is the adjusted image.
-//  The resources directory includes two Python scripts:
-//    * "encode_windows.py"
-//      This encodes regions in "MacPaint 480x320.png" (and "Icon.png", "Busy.png" & Disk.png) as 
-//      1-bpp PROGMEM arrays written to "GraphicsData.h" which is copied up a level and #included 
-//      into App.cpp. This is  how the parts of the screen (tools, fills) are rendered 
-//      (see DrawOneBPPData()).
-//      It uses the PIL library, https://pillow.readthedocs.io/en/stable/
-//      There is a simple duplicate-row compression scheme.
-//    * "encode_font.py"
-//      This scans "Chicago-12.bdf" and builds a single 1-bpp PROGMEM array of the character pixels
-//      in "FontData.h" which is copied up a level and #included into App.cpp.
-//
-// Slides:
-//  Refer to the "slides" subdirectory.
-//  I have automated the process of taking a directory full of JPGs (eg photos) and converting them
-//  to the format required.  The JPGs are copied as appropriately resized uncompressed bitmaps in a 
-//  specified folder.  They are converted from colour to either 
-//    * monochrome images dithered with a 3x3 tile OR
-//    * 4-bit greyscale images
-//  This is achieved by the "make_slides.bat" file and by using *ImageMagick* to make the image edits.
-//  ImageMagick MUST be installed, and ideally be on the path (but see "magick_exe" in the batch file).
-//  The batch file can be configured in several ways, how to size-to-fit Landscape images, whether to 
-//  include Portrait images etc.
-//  Note that dithered monochrome looks better, is more in keeping with the MacPaint aesthetic, but 
-//  greyscale does produce more realistic images.
-// 
-//  The SD library interface is "8.3", meaning that photos with meaningful filenames will be called things
-//  like "WEDDIN~1.BMP". To counter this, "make_slides.bat" can optionally append to the .BMP
-//    * the original file name and/or
-//    * image date information (from EXIF)
-//  The sketch will use this text, if found, to caption the slides instead of the raw file name.
-//
-// Random display:
-//  Displaying the files randomly (CFG_RANDOM_ORDER) incurs a cost as the directory is scanned
-//  to the Nth file, this may take some time (500 files in ~40seconds, YMMV) a "disk" icons is
-//  shown on the far right of the menu bar.
-
-// Configuration:
-//  Config.h has a number of defines to control the sketch behavour, for example CFG_IMAGE_FOLDER
-//  sets the location of the slides, CFG_SECONDS_BETWEEN_IMAGES sets the seconds between images, etc, etc.
-//
-// Touch:
-//  There is basic touch support (if applicable, see CFG_LCD_HAS_TOUCH). 
-//  Touching in the image pauses or resumes the slideshow. 
-//  Touching elsewhere randomizes the slides (if applicable, see CFG_RANDOM_ORDER). The PRNG is seeded
-//  from millis(), touch position and current image file name.
-//  Touch is only checked when idle -- when there is no busy icon on the menu bar's far right.
-//
-// Libraries:
-//  Because speed is not really a consideration, I've used an external library to deal with the LCD.
-//  The interface the code deals with is my usual "define a window, send pixels to it" but implemented
-//  (a little awkwardly) with the MCUFRIEND_kbv library.  The library can auto-detect the LCD but I've 
-//  hard-wired mine (to save space. try running CUFRIEND_kbv sample diagnose_TFT_support).  
-//  The library compiles with warnings when Compiler warnings:All is set.
-//  I use the SD library for reading the MicroSD card, it also compiles with warnings when 
-//  All is set.
-//  The libraries bulk out the size of the sketch to ~98% of program storage space.
-//
-// Requirements:
-//  Arduino Uno
-//  MicroSD card                I've used a no-name "6GB U3 Class 10 MicroSD" and a Verbatum "16GB Class 10 MicroSDHC". YMMV.
-//  SD adaptor/reader           I used https://www.jaycar.co.nz/usb-micro-sd-card-reader/p/XC4740
-//  480x320 LCD Shield:         https://www.waveshare.com/4inch-tft-touch-shield.htm (or similar! YMMV!)
-//  The MCUFRIEND_kbv library:  https://docs.arduino.cc/libraries/mcufriend_kbv/
-//  The SD library:             https://docs.arduino.cc/libraries/sd/
-//  ImageMagick:                https://imagemagick.org/
-// If rebuilding resources
-//  Python & PIL                https://pillow.readthedocs.io/en/stable/
-//
-// Links:
-//  https://archive.org/details/mac_Paint_2
-//  https://en.wikipedia.org/wiki/MacPaint
-//  https://github.com/danfe/fonts
-//
-// Mark Wilson. Dec 2025
-
-
-void setup() 
-{
-#ifdef DEBUG
-  Serial.begin(9600);
-  Serial.println(";LackPaint");
-  SERIALISE_ON(false); // see SERIALIZE in LCD.h
-#endif  
-  LCD_INIT();
-  App::Init();
-}
-
-void loop()
-{
-  App::Loop();
-}
+#include <SPI.h>
+// These two compile with warnings
+#include <SD.h> // v1.3.0
+// External libraries
+#include <MCUFRIEND_kbv.h> // v3.0.0
+
+#include "Config.h"
+#include "LCD.h"
+#include "App.h"
+
+//  L a c k P a i n t
+//
+// What:
+//  A photoframe in the style of v1.0 of MacPaint (1981) (https://en.wikipedia.org/wiki/MacPaint)
+//  It uses a Arduino Uno and 480x320 LCD shield with built-in SD card support.  
+//  Files are loaded from a directory on a MicroSD card on the LCD shield and displayed 
+//  sequentially or randomly.
+//  The images on the card MUST be
+//    * uncompressed bitmaps (.BMP), and either
+//    * monochrome (1 bit-per-pixel) OR
+//    * 4-bit greyscale.
+//    * ideally sized to fit the display window's width (396 pixels) and/or height (218 pixels).
+//  Other sizes are centred and clipped, much larger ones are reduced by 2, 3 or 4 first.
+//  By default they are pulled from the SLIDES folder in the SD card (but see CFG_IMAGE_FOLDER).
+//   
+//  The look is based closely on the original MacPaint but adjusted to work with the LCD's aspect
+//  ratio.  I have reduced the original's dimensions by removing 
+//    * a column of fill styles (second from right) and 
+//    * a row of tools (second from bottom)
+//  Refer to the "resources" subdirectory: 
+//    * "MacPaint Original.png" is the reference image,
+//    * "MacPaint 480x320.png" is the adjusted image.
+//  The resources directory includes two Python scripts:
+//    * "encode_windows.py"
+//      This encodes regions in "MacPaint 480x320.png" (and "Icon.png", "Busy.png" & Disk.png) as 
+//      1-bpp PROGMEM arrays written to "GraphicsData.h" which is copied up a level and #included 
+//      into App.cpp. This is  how the parts of the screen (tools, fills) are rendered 
+//      (see DrawOneBPPData()).
+//      It uses the PIL library, https://pillow.readthedocs.io/en/stable/
+//      There is a simple duplicate-row compression scheme.
+//    * "encode_font.py"
+//      This scans "Chicago-12.bdf" and builds a single 1-bpp PROGMEM array of the character pixels
+//      in "FontData.h" which is copied up a level and #included into App.cpp.
+//
+// Slides:
+//  Refer to the "slides" subdirectory.
+//  I have automated the process of taking a directory full of JPGs (eg photos) and converting them
+//  to the format required.  The JPGs are copied as appropriately resized uncompressed bitmaps in a 
+//  specified folder.  They are converted from colour to either 
+//    * monochrome images dithered with a 3x3 tile OR
+//    * 4-bit greyscale images
+//  This is achieved by the "make_slides.bat" file and by using *ImageMagick* to make the image edits.
+//  ImageMagick MUST be installed, and ideally be on the path (but see "magick_exe" in the batch file).
+//  The batch file can be configured in several ways, how to size-to-fit Landscape images, whether to 
+//  include Portrait images etc.
+//  Note that dithered monochrome looks better, is more in keeping with the MacPaint aesthetic, but 
+//  greyscale does produce more realistic images.
+// 
+//  The SD library interface is "8.3", meaning that photos with meaningful filenames will be called things
+//  like "WEDDIN~1.BMP". To counter this, "make_slides.bat" can optionally append to the .BMP
+//    * the original file name and/or
+//    * image date information (from EXIF)
+//  The sketch will use this text, if found, to caption the slides instead of the raw file name.
+//
+// Random display:
+//  Displaying the files randomly (CFG_RANDOM_ORDER) incurs a cost as the directory is scanned
+//  to the Nth file, this may take some time (500 files in ~40seconds, YMMV) a "disk" icons is
+//  shown on the far right of the menu bar.
+
+// Cache:
+//  Optionally (CFG_SLIDE_CACHE_FOLDER) the first showing of a slide writes a transcoded copy of what was painted
+//  to a cache folder on the card. Later showings paint from the copy, which is quicker, while the source file is unchanged.
+
+// Playlist:
+//  Optionally (CFG_PLAYLIST) a text file in the image folder lists the slides to show, in order, one per line, 
+//  each with an optional number of seconds to show it for, e.g. "BEACH.BMP 20". It's read one line per slide.
+
+// History:
+//  Optionally (CFG_HISTORY_SIZE) recently shown slides are remembered. Touching the left edge of the slide goes back
+//  through them, the right edge goes forward again (and then on to the next slide).
+
+// FatBits:
+//  Optionally (CFG_FATBITS) touching a paused slide shows the area around the touch zoomed in, 2x, then 4x, then 8x 
+//  on the next touches (read straight from the slide file). The touch after that shows the whole slide and resumes.
+
+// Thumbnails:
+//  Optionally (CFG_THUMBNAIL_FOLDER) make_slides.bat also makes a small 1bpp thumbnail of each slide. Touching the tools
+//  window shows a sheet of them, touch one to show its slide. The fill window shows a strip of the sheets, touch one to 
+//  go to it. Touching anywhere else returns to the slideshow.
+
+// Streaming:
+//  Optionally (CFG_SERIAL_INGEST) slides can be pushed over Serial from a host (see resources/stream_slides.py).
+//  They are run-length-encoded and painted as they arrive, with flow control so the Uno's small Serial buffer
+//  never overflows. Each is shown for the usual time, then the SD card slides carry on.
+
+// Tasks:
+//  App::Loop() runs a few tasks (streaming, the next slide, touch) on a tiny run-to-completion scheduler
+//  (Tasks.h), each with a period and a time budget. If DEBUG, their overruns and worst run and start
+//  times are reported to Serial every minute, with the RAM headroom (Memory.h, and resources/ram_report.py).
+//  Optionally (CFG_STATS) each slide's time is split into phases (Stats.h), shown by touching the menu bar.
+//  Optionally (CFG_SLEEP) the Uno powers down whenever nothing's due, until the next slide or a touch (Power.h).
+
+// Configuration:
+//  Config.h has a number of defines to control the sketch behavour, for example CFG_IMAGE_FOLDER
+//  sets the location of the slides, CFG_SECONDS_BETWEEN_IMAGES sets the seconds between images, etc, etc.
+//
+// Touch:
+//  There is basic touch support (if applicable, see CFG_LCD_HAS_TOUCH). 
+//  Touching in the image pauses or resumes the slideshow. 
+//  Touching elsewhere randomizes the slides (if applicable, see CFG_RANDOM_ORDER). The PRNG is seeded
+//  from millis(), touch position and current image file name.
+//  Touch is also checked every few rows while a slide paints. Touching the image then pauses once it's painted,
+//  touching elsewhere (or a history edge) stops painting it and skips to the next slide (or does what the touch does).
+//  It isn't checked while scanning the folder -- when the busy icon is on the menu bar's far right before painting.
+//  Optionally (CFG_TOUCH_SAMPLER) it's sampled in the background on Timer2 instead, and taps are queued.
+//
+// Libraries:
+//  Because speed is not really a consideration, I've used an external library to deal with the LCD.
+//  The interface the code deals with is my usual "define a window, send pixels to it" but implemented
+//  (a little awkwardly) with the MCUFRIEND_kbv library.  The library can auto-detect the LCD but I've 
+//  hard-wired mine (to save space. try running CUFRIEND_kbv sample diagnose_TFT_support).  
+//  The library compiles with warnings when Compiler warnings:All is set.
+//  I use the SD library for reading the MicroSD card, it also compiles with warnings when 
+//  All is set.
+//  The libraries bulk out the size of the sketch to ~98% of program storage space.
+//
+// Requirements:
+//  Arduino Uno
+//  MicroSD card                I've used a no-name "6GB U3 Class 10 MicroSD" and a Verbatum "16GB Class 10 MicroSDHC". YMMV.
+//  SD adaptor/reader           I used https://www.jaycar.co.nz/usb-micro-sd-card-reader/p/XC4740
+//  480x320 LCD Shield:         https://www.waveshare.com/4inch-tft-touch-shield.htm (or similar! YMMV!)
+//  The MCUFRIEND_kbv library:  https://docs.arduino.cc/libraries/mcufriend_kbv/
+//  The SD library:             https://docs.arduino.cc/libraries/sd/
+//  ImageMagick:                https://imagemagick.org/
+// If rebuilding resources
+//  Python & PIL                https://pillow.readthedocs.io/en/stable/
+//
+// Links:
+//  https://archive.org/details/mac_Paint_2
+//  https://en.wikipedia.org/wiki/MacPaint
+//  https://github.com/danfe/fonts
+//
+// Mark Wilson. Dec 2025
+
+
+void setup() 
+{
+#ifdef DEBUG
+  Serial.begin(9600);
+  Serial.println(";LackPaint");
+  SERIALISE_ON(false); // see SERIALIZE in LCD.h
+#endif  
+  LCD_INIT();
+  App::Init();
+}
+
+void loop()
+{
+  App::Loop();
+}
@@ -0,0 +1,58 @@
+#include <Arduino.h>
+#include "Config.h"
+#include "Memory.h"
+#include "Scratch.h"
+
+#ifdef DEBUG
+// The 2K of RAM is the globals (.data & .bss, see resources/ram_report.py), then the heap (if anything
+// uses malloc), then free, then the stack growing down from the top.
+#define MEMORY_PAINT 0xA5
+
+extern uint8_t _end;          // the end of the globals
+extern uint8_t __stack;       // the top of RAM
+extern uint8_t* __brkval;     // the top of the heap, 0 if unused
+
+// runs before the globals are initialised (or anything is on the stack), so no frame and no calls
+void MemoryPaint() __attribute__((naked, used, section(".init3")));
+void MemoryPaint()
+{
+  // fill the RAM above the globals
+  for (uint8_t* pByte = &_end; pByte <= &__stack; pByte++)
+    *pByte = MEMORY_PAINT;
+}
+
+namespace Memory
+{
+  uint8_t* HeapEnd()
+  {
+    // where the free RAM starts
+    return __brkval?__brkval:&_end;
+  }
+
+  uint16_t Free()
+  {
+    // bytes between the heap and the stack now
+    uint8_t top;
+    return &top - HeapEnd();
+  }
+
+  uint16_t Unused()
+  {
+    // bytes above the heap the stack has never reached
+    uint8_t* pByte = HeapEnd();
+    while (pByte <= &__stack && *pByte == MEMORY_PAINT)
+      pByte++;
+    return pByte - HeapEnd();
+  }
+
+  void Report()
+  {
+    // the headroom to Serial
+    Serial.print(";RAM ");Serial.print(Free());
+    Serial.print(" bytes free, ");Serial.print(Unused());
+    Serial.print(" never used by the stack, ");Serial.print(Scratch::HighWater());
+    Serial.print(" of ");Serial.print(SCRATCH_SIZE);
+    Serial.println(" scratch used");
+  }
+};
+#endif
@@ -0,0 +1,9 @@
+#pragma once
+
+// RAM headroom, with DEBUG. The free RAM is painted at startup, so how much of it the stack never reached can be found
+namespace Memory
+{
+  uint16_t Free();
+  uint16_t Unused();
+  void Report();
+};
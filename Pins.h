@@ -1,11 +1,11 @@
-#pragma once
-
-// Just Uno+LCD shield. 
-// The only interesting pins we might have some options with are:
-// SD
-#define PIN_SD_CHIP_SELECT  10
-// LCD/Touch
-#define PIN_TOUCH_X_ANALOG  A1
-#define PIN_TOUCH_X_DIGITAL  7
-#define PIN_TOUCH_Y_ANALOG  A2
-#define PIN_TOUCH_Y_DIGITAL  6
+#pragma once
+
+// Just Uno+LCD shield. 
+// The only interesting pins we might have some options with are:
+// SD
+#define PIN_SD_CHIP_SELECT  10
+// LCD/Touch
+#define PIN_TOUCH_X_ANALOG  A1
+#define PIN_TOUCH_X_DIGITAL  7
+#define PIN_TOUCH_Y_ANALOG  A2
+#define PIN_TOUCH_Y_DIGITAL  6
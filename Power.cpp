@@ -0,0 +1,137 @@
+#include <Arduino.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+#include "Config.h"
+#include "Pins.h"
+#include "Power.h"
+
+#ifdef CFG_SLEEP
+// Power-down stops everything but the watchdog and pin-change interrupts, so the watchdog wakes it,
+// in steps of 16ms * 2^n, and millis() is wound on by each step (Arduino's count isn't otherwise exposed).
+// A touch wakes it part way through a step, counted as half.
+extern volatile unsigned long timer0_millis;
+
+ISR(WDT_vect)
+{
+  // just wakes
+}
+
+#ifdef CFG_LCD_HAS_TOUCH
+ISR(PCINT1_vect) // PIN_TOUCH_X_ANALOG is on port C
+{
+  // just wakes
+}
+#endif
+
+namespace Power
+{
+  const uint8_t kMaxStep = 9; // 8s
+  uint32_t awakeMS = 0;
+  uint32_t asleepMS = 0;
+  uint32_t wokeMS = 0;
+
+#ifdef CFG_LCD_HAS_TOUCH
+  bool ArmTouch()
+  {
+    // make a touch pull PIN_TOUCH_X_ANALOG low, interrupting. false if it's touched already
+    // (the panel's plates are pulled together, the LCD ignores its pins while it's not selected)
+    pinMode(PIN_TOUCH_X_DIGITAL, INPUT);
+    pinMode(PIN_TOUCH_Y_ANALOG, INPUT);
+    pinMode(PIN_TOUCH_Y_DIGITAL, OUTPUT);
+    digitalWrite(PIN_TOUCH_Y_DIGITAL, LOW);
+    pinMode(PIN_TOUCH_X_ANALOG, INPUT_PULLUP);
+    delayMicroseconds(50); // charge the panel
+    if (!digitalRead(PIN_TOUCH_X_ANALOG))
+      return false;
+    *digitalPinToPCMSK(PIN_TOUCH_X_ANALOG) |= bit(digitalPinToPCMSKbit(PIN_TOUCH_X_ANALOG));
+    PCIFR = bit(digitalPinToPCICRbit(PIN_TOUCH_X_ANALOG));
+    *digitalPinToPCICR(PIN_TOUCH_X_ANALOG) |= bit(digitalPinToPCICRbit(PIN_TOUCH_X_ANALOG));
+    return true;
+  }
+
+  bool DisarmTouch()
+  {
+    // restore the pins for the LCD, true if it was touched
+    *digitalPinToPCICR(PIN_TOUCH_X_ANALOG) &= ~bit(digitalPinToPCICRbit(PIN_TOUCH_X_ANALOG));
+    bool touched = !digitalRead(PIN_TOUCH_X_ANALOG);
+    digitalWrite(PIN_TOUCH_X_ANALOG, LOW); // pull-up off
+    pinMode(PIN_TOUCH_X_ANALOG, OUTPUT);
+    pinMode(PIN_TOUCH_X_DIGITAL, OUTPUT);
+    pinMode(PIN_TOUCH_Y_ANALOG, OUTPUT);
+    return touched;
+  }
+#endif
+
+  bool SleepStep(uint8_t step)
+  {
+    // power down for 16ms << step, or until touched. true if it slept the whole step
+    uint8_t prescale = (step & 0x08)?(_BV(WDP3) | (step & 0x07)):step;
+    bool whole = true;
+    uint8_t adc = ADCSRA;
+    ADCSRA = 0;
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    cli();
+#ifdef CFG_LCD_HAS_TOUCH
+    if (!ArmTouch())
+    {
+      DisarmTouch();
+      sei();
+      ADCSRA = adc;
+      return false;
+    }
+#endif
+    wdt_reset();
+    MCUSR &= ~_BV(WDRF);
+    WDTCSR = _BV(WDCE) | _BV(WDE);
+    WDTCSR = _BV(WDIE) | prescale; // interrupt, no reset
+    sleep_enable();
+    sei(); // (the instruction after sei runs before any interrupt)
+    sleep_cpu();
+    sleep_disable();
+    cli();
+    wdt_disable();
+#ifdef CFG_LCD_HAS_TOUCH
+    whole = !DisarmTouch();
+#endif
+    uint32_t slept = whole?(16UL << step):(8UL << step);
+    timer0_millis += slept;
+    sei();
+    ADCSRA = adc;
+    asleepMS += slept;
+    return whole;
+  }
+
+  void Sleep(uint32_t ms)
+  {
+    // power down for about ms (a whole number of the watchdog's steps, none under 16ms), or until touched
+    if (ms < 16)
+      return;
+#ifdef DEBUG
+    Serial.flush();
+#endif
+    awakeMS += millis() - wokeMS;
+    while (ms >= 16)
+    {
+      uint8_t step = 0;
+      while (step < kMaxStep && (32UL << step) <= ms)
+        step++;
+      if (!SleepStep(step))
+        break;
+      ms -= 16UL << step;
+    }
+    wokeMS = millis();
+  }
+
+  void Report()
+  {
+    // the time awake and asleep to Serial, for an estimate of the average current
+#ifdef DEBUG
+    uint32_t awake = awakeMS + (millis() - wokeMS);
+    Serial.print(";awake ");Serial.print(awake);
+    Serial.print("ms, asleep ");Serial.print(asleepMS);
+    Serial.print("ms, duty ");Serial.print(awake / ((awake + asleepMS) / 100 + 1));
+    Serial.println("%");
+#endif
+  }
+};
+#endif
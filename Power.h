@@ -0,0 +1,8 @@
+#pragma once
+
+// Sleeping between slides, see CFG_SLEEP
+namespace Power
+{
+  void Sleep(uint32_t ms);
+  void Report();
+};
@@ -0,0 +1,63 @@
+#include <Arduino.h>
+#include "Config.h"
+#include "Scratch.h"
+
+namespace Scratch
+{
+  uint8_t block[SCRATCH_SIZE];
+  uint16_t used = 0;
+  uint8_t levels = 0;   // Scopes open
+  uint16_t highWater = 0;
+
+  void Check(bool ok, const char* pWhat)
+  {
+    // stop if a rule's broken
+#ifdef DEBUG
+    if (!ok)
+    {
+      Serial.print(";scratch: ");Serial.println(pWhat);
+      while (true)
+        ;
+    }
+#else
+    (void)ok;
+    (void)pWhat;
+#endif
+  }
+
+  Scope::Scope() : mark(used), level(++levels)
+  {
+  }
+
+  Scope::~Scope()
+  {
+    // give back what was taken in it
+    Check(level == levels, "scope ended out of order");
+    used = mark;
+    levels--;
+  }
+
+  void* Scope::Take(uint16_t bytes)
+  {
+    // bytes from the block, until the Scope ends
+    Check(level == levels, "not the innermost scope");
+    Check(used + bytes <= SCRATCH_SIZE, "out of space");
+    void* pBytes = block + used;
+    used += bytes;
+    if (used > highWater)
+      highWater = used;
+    return pBytes;
+  }
+
+  uint16_t Scope::Left()
+  {
+    // bytes that could still be taken
+    return SCRATCH_SIZE - used;
+  }
+
+  uint16_t HighWater()
+  {
+    // the most that's been in use
+    return highWater;
+  }
+};
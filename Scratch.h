@@ -0,0 +1,28 @@
+#pragma once
+
+// Short-lived buffers (names, paths, a row being read), taken from one static block as a stack.
+// What's taken in a Scope is given back when it ends, so Scopes must end in reverse order, and only
+// the innermost can take more. With DEBUG that's checked, and running out stops with a message.
+#ifdef CFG_DIFF_REPAINT
+#define SCRATCH_SIZE 272 // a caption, a path and a whole unscaled 4BPP row, so it's compared before it's painted
+#elif defined(CFG_STATS)
+#define SCRATCH_SIZE 144 // a caption and the stats line, drawn after the slide (or a caption and a read buffer)
+#else
+#define SCRATCH_SIZE 128 // a caption and a read buffer, see Slides::PaintCurrent
+#endif
+
+namespace Scratch
+{
+  struct Scope
+  {
+    uint16_t mark;  // what was in use when it started
+    uint8_t level;
+
+    Scope();
+    ~Scope();
+    void* Take(uint16_t bytes);
+    uint16_t Left();
+  };
+
+  uint16_t HighWater();
+};
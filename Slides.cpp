@@ -1,411 +1,1474 @@
-#include <Arduino.h>
-#include <SPI.h>
-#include <SD.h>
-#include "Pins.h"
-#include "Config.h"
-#include "LCD.h"
-#include "Slides.h"
-
-namespace Slides
-{
-  // see  https://docs.arduino.cc/libraries/sd/
-  File root;
-  bool haveFile = false;
-  char fileName[8 + 1 + 3 + 1]; // space for 8.3 + NUL
-
-  bool CheckFile(File& file)
-  {
-    // true if the files is not a directory
-    // copies file name
-    // closes file 
-    if (file)
-    {
-      if (!file.isDirectory())
-      {
-        haveFile = true;
-        strcpy(fileName, file.name());
-      }
-      file.close();
-      return true;
-    }
-    return false;
-  }
-
-#ifdef CFG_RANDOM_ORDER
-  // images cycle in pseudo-random order
-  uint32_t numberOfFiles = 0;
-  uint32_t previousN = 0;
-  uint32_t seed = 0; // generate some entropy from all the file names and seed the PRNG
-
-  uint32_t ScanFiles(uint32_t n)
-  {
-    // scan the directory counting files
-    // if n is non-zero, stops on the nth file (counting from 1)
-    // if n is 0, scans ALL files and, if not DEBUG, generates a PRNG seed from the names
-    // returns the number of files scanned
-    // 
-    uint32_t count = 0;
-    root = SD.open(CFG_IMAGE_FOLDER);
-    if (root)
-    {
-      while (count != n || n == 0)
-      {
-        File file = root.openNextFile();
-        if (file)
-        {
-          if (CheckFile(file))
-          {
-            count++;
-#ifndef DEBUG
-            if (n==0)
-              seed ^= NameAsSeed();
-#endif
-          }
-          file.close();
-        }
-        else
-          break;  // done
-      }
-      root.close();
-    }
-    return count;
-  }
-  
-  void GetFirst()
-  {
-    // count the images, set the current image to the LAST
-    // if not DEBUG, seeds the PRNG
-    numberOfFiles = 0;
-    if (SD.begin(PIN_SD_CHIP_SELECT) && SD.exists(CFG_IMAGE_FOLDER))
-      numberOfFiles = ScanFiles(0);
-    haveFile = numberOfFiles != 0;
-    previousN = numberOfFiles;
-#ifndef DEBUG
-    if (seed)
-      randomSeed(seed);
-#endif
-  }
-
-  void GetNext()
-  {
-    // get a random file
-    haveFile = false;
-    if (numberOfFiles)
-    {
-      uint32_t n = random(numberOfFiles) + 1;
-      if (n == previousN) // make ONE attempt at avoiding duplicate
-        n = random(numberOfFiles) + 1;
-      previousN = n;
-      haveFile = ScanFiles(n) == n;
-    }
-  }
-#else
-  // images cycle in directory order
-  void GetFirst()
-  {
-    // find the first image in the folder
-    haveFile = false;
-    if (SD.begin(PIN_SD_CHIP_SELECT) && SD.exists(CFG_IMAGE_FOLDER))
-    {
-      root = SD.open(CFG_IMAGE_FOLDER);
-      File file = root.openNextFile();
-      CheckFile(file);
-    }
-  }
-
-  void GetNext()
-  {
-    // find the next image in the folder
-    File file;
-    if (haveFile)
-    {
-      file = root.openNextFile();
-      if (!CheckFile(file))
-      {
-        // start again
-        haveFile = false;
-        root.close();
-        root = SD.open(CFG_IMAGE_FOLDER);
-        file = root.openNextFile();
-        CheckFile(file);
-      }
-    }
-  }
-#endif
-
-  uint32_t ReadDWord(File& file)
-  {
-    // BMP is little-endian
-    uint32_t dw = 0;
-    for (uint32_t b = 0; b < 4; b++)
-    {
-      uint32_t temp = file.read();
-      dw |= temp << (8UL*b);
-    }
-    return dw;
-  }
-  
-  bool ExtractOriginalName(File& file, char* pName)
-  {
-    // original file name may be appended to .BMP as:
-    //  "NAME:=\r\n<name-with-extension> etc\r\n"
-    uint32_t sig = 0;
-    int idx = 0;
-    char name[SLIDE_APPENDED_TEXT_MAX_LEN + 1];
-    // Is there an original name appended to the file?
-    // go back from EOF by: max len of name, plus start sig size, plus final \r\n, plus a fudge.
-    file.seek(file.size() - (SLIDE_APPENDED_TEXT_MAX_LEN + 8 + 2 + 2));
-    while (file.peek() != -1)
-    {
-      sig <<= 8;
-      sig |= file.read();
-      if (sig == 0x4E414D45UL && ReadDWord(file) == 0x0A0D3D3AUL) // "NAME" and ":=\r\n" (with different byte-order)
-      {
-        // start found, try building a string
-        while (file.peek() != -1)
-        {
-          char ch = file.read();
-          if (::isprint(ch))
-          {
-            if (idx < SLIDE_APPENDED_TEXT_MAX_LEN)
-              name[idx++] = ch;
-            else
-              break;  // too long
-          }
-          else if (ch == '\r')
-          {
-            // found the end, done and good
-            name[idx] = '\0';
-            strcpy(pName, name);
-            return true;
-          }
-          else
-            break; // invalid char
-        }
-        break;
-      }
-    }
-    return false;
-  }
-
-  uint8_t lfsr = 0x55; // anything non-zero
-  uint8_t GetLFSR(uint8_t max)
-  {
-      // returns 0..max-1 in pseudo-random order
-      // Taps at 8, 6, 5 & 4. T=255
-      while (true)
-      {
-        uint8_t temp = ((lfsr >> 0) ^ (lfsr >> 2) ^ (lfsr >> 3) ^ (lfsr >> 4)) & 1u;
-        lfsr >>= 1;
-        lfsr |= (uint8_t)(temp << 7);
-        temp = lfsr - 1;
-        if (temp < max)
-          return temp;
-      }
-  }
-
-  bool PaintCurrent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, char* pName)
-  {
-    // draws current BMP into a window x, y, w, h and fills-in pName
-    // returns true if successful (valid bmp, no compression, size OK etc)
-    // BMP: https://www.ece.ualberta.ca/~elliott/ee552/studentAppNotes/2003_w/misc/bmp_file_format/bmp_file_format.htm
-    strcpy(pName, "");
-    bool result = false;
-    if (haveFile)
-    {
-      // provide the name of potentially bad file
-      strcpy(pName, fileName);
-      strcat(pName, "?");
-      char name[32];
-      strcpy(name, CFG_IMAGE_FOLDER);
-      strcat(name, fileName);
-      File file = SD.open(name, FILE_READ);
-      if (!file)
-        return result;
-
-      if (file.read() == 'B' && file.read() == 'M') // BMP Signature
-      {
-        file.seek(0x000A);
-        uint32_t DataOffset = ReadDWord(file);
-        // InfoHeader
-        uint32_t Size = ReadDWord(file);
-        uint32_t Width = ReadDWord(file);
-        uint32_t Height = ReadDWord(file);
-        uint32_t BPP = ReadDWord(file) >> 16;
-        file.seek(0x001E);
-        uint32_t Compression = ReadDWord(file); 
-        file.seek(0x0036);
-        uint32_t Palette0 = ReadDWord(file); 
-
-        if (Size == 40 &&                 // Version 3.x BMP
-          (Width == w || Height == h) &&  // must fit in onde direction
-#ifdef CFG_GREYSCALE_BITS
-          (BPP == 1 || BPP == 4) &&       // mono or 4BPP
-#else            
-          BPP == 1 &&                     // mono
-#endif            
-          Compression == 0 &&             // uncompressed
-          Palette0 == 0)                  // 0=black
-        {
-          uint32_t StartRow = 0;
-          uint32_t StartCol = 0;
-          uint32_t EndCol = Width;
-          uint32_t PaintX = x;
-          uint32_t PaintWidth = w;
-          bool dimsOK = true;
-          if (Height == h)
-          {
-            // height fits, deal with width
-            if (Width < w)
-            {
-              // need whitespace either side
-              uint32_t blankCols = (w - Width) / 2;
-              PaintX = x + blankCols;
-              PaintWidth = Width;
-              LCD_FILL_RECT(x, y, blankCols, h, CFG_GAP_FILL_COLOUR); // left
-              blankCols = w - Width - blankCols;
-              LCD_FILL_RECT(PaintX + Width, y, blankCols, h, CFG_GAP_FILL_COLOUR); // right              
-            }
-            else if (Width >= w)
-            {
-              // need to clip either side
-              StartCol = (Width - w)/2;
-              EndCol = Width - StartCol;
-            }
-          }
-          else if (Width == w)
-          {
-            // width fits, deal with height
-            if (Height >= h) // fits or taller. paint the central strip
-              StartRow = (Height - h) / 2;
-            else
-             dimsOK = false; // won't do a thin strip
-          }
-          else
-            dimsOK = false;  // must fit in one direction
-
-          if (dimsOK)
-          {
-            uint32_t RowSize = (BPP*Width) / 8;
-            if ((BPP*Width) % 8)
-              RowSize++; // extra byte
-            if (RowSize % 4)
-              RowSize += (4 - (RowSize % 4)); // row is multiple of 4 bytes
-#ifndef CFG_DISSOLVE
-            LCD_BEGIN_FILL(PaintX, y, PaintWidth, h);
-#endif            
-            if (BPP == 1)
-              for (uint32_t rowCtr = 0; rowCtr < h; rowCtr++)
-              {
-#ifdef CFG_DISSOLVE
-                int row = GetLFSR(h);
-                LCD_BEGIN_FILL(PaintX, y + row, PaintWidth, 1);
-#else
-                int row = rowCtr;
-#endif  
-                // rows are in reverse order
-                file.seek(DataOffset + (Height - row - 1 - StartRow) * RowSize);
-                uint8_t Mask = 0x80;
-                uint8_t Values[4];
-                file.read(Values, sizeof(Values)); // read 4 bytes at a time, faster paint
-                uint8_t* pValue = Values;
-                uint8_t ctr = sizeof(Values);
-                for (uint32_t col = 0; col < Width; col++)
-                {
-                  if (StartCol <= col && col < EndCol)
-                  {
-                    // not clipped
-                    if (*pValue & Mask) // 1 is white, 0 is black 
-                      LCD_ONE_WHITE();
-                    else
-                      LCD_ONE_BLACK();
-                  }
-                  Mask >>= 1;
-                  if (!Mask)
-                  {
-                    Mask = 0x80;
-                    if (--ctr)
-                      pValue++;
-                    else
-                    {
-                     file.read(Values, sizeof(Values));
-                     pValue = Values;
-                     ctr = sizeof(Values);
-                    }
-                  }
-                }
-              }
-#ifdef CFG_GREYSCALE_BITS
-            else
-              for (uint32_t rowCtr = 0; rowCtr < h; rowCtr++)
-              {
-#ifdef CFG_DISSOLVE
-                int row = GetLFSR(h);
-                LCD_BEGIN_FILL(PaintX, y + row, PaintWidth, 1);
-#else
-                int row = rowCtr;
-#endif  
-                // rows are in reverse order
-                file.seek(DataOffset + (Height - row - 1 - StartRow) * RowSize);
-                bool hi = true;
-                uint8_t Values[4];
-                file.read(Values, sizeof(Values)); // read 4 bytes at a time, faster paint
-                uint8_t* pValue = Values;
-                uint8_t ctr = sizeof(Values);
-                for (uint32_t col = 0; col < Width; col++)
-                {
-                  uint8_t component = hi ? (*pValue >> 4) : (*pValue & 0x0F);
-  
-                  // reduce grey values, 4, 2 or 1
-                  uint8_t shift = 4 - CFG_GREYSCALE_BITS;
-                  component >>= shift;
-                  component <<= shift;
-  
-                  component = component | (component << 4);
-                  LCD_FILL_COLOUR(1, RGB(component, component, component));
-                  hi = !hi;
-                  if (hi)
-                  {
-                    if (--ctr)
-                      pValue++;
-                    else
-                    {
-                      file.read(Values, sizeof(Values));
-                      pValue = Values;
-                      ctr = sizeof(Values);
-                    }
-                  }
-                }
-              }
-#endif
-     
-#ifdef CFG_READ_IMAGE_NAME          
-            if (!ExtractOriginalName(file, pName))
-#endif
-              strcpy(pName, file.name());
-  
-#ifndef CFG_SHOW_IMAGE_EXT
-            if (*pName && strlen(pName) > 4 && *(pName + strlen(pName) - 4) == '.')
-              *(pName + strlen(pName) - 4) = '\0'; // zap the extension
-#endif
-#ifdef CFG_LOWERCASE_IMAGE_NAME
-            char*pCtr = pName;
-            while (*pName)
-              *pName = ::tolower(*pName++);
-#endif
-            result = true;
-          }
-        }
-      }
-      file.close();
-    }
-    return result;
-  }
-
-  uint32_t NameAsSeed()
-  {
-    // return the first 4 chars of the current filename as a uint32_t (for entropy)
-    return *((uint32_t*)fileName);
-  }
-
-};
+#include <Arduino.h>
+#include <SPI.h>
+#include <SD.h>
+#include "Pins.h"
+#include "Config.h"
+#include "LCD.h"
+#include "Slides.h"
+#include "Transitions.h"
+#include "Stats.h"
+#include "Scratch.h"
+
+namespace Slides
+{
+  const uint8_t kPathLen = 32; // a folder and an 8.3 name
+  // see  https://docs.arduino.cc/libraries/sd/
+  File root;
+  bool haveFile = false;
+  char fileName[8 + 1 + 3 + 1]; // space for 8.3 + NUL
+
+  bool CheckFile(File& file)
+  {
+    // true if the files is not a directory
+    // copies file name
+    // closes file 
+    if (file)
+    {
+      if (!file.isDirectory())
+      {
+        haveFile = true;
+        strcpy(fileName, file.name());
+      }
+      file.close();
+      return true;
+    }
+    return false;
+  }
+
+  bool BeginSD()
+  {
+    // true if the card and the image folder are there
+    if (SD.begin(PIN_SD_CHIP_SELECT) && SD.exists(CFG_IMAGE_FOLDER))
+    {
+#ifdef CFG_SLIDE_CACHE_FOLDER
+      if (!SD.exists(CFG_SLIDE_CACHE_FOLDER))
+        SD.mkdir(CFG_SLIDE_CACHE_FOLDER);
+#endif
+      return true;
+    }
+    return false;
+  }
+
+#ifdef CFG_HISTORY_SIZE
+  // the names of recently shown slides, to go back to them with a single open
+  char history[CFG_HISTORY_SIZE][8 + 1 + 3 + 1];
+  uint8_t historyNewest = 0;  // index of the newest
+  uint8_t historyCount = 0;
+  uint8_t historyBack = 0;    // steps back from the newest to the current one
+
+  void Remember()
+  {
+    // add the new current file to the history
+    if (haveFile)
+    {
+      historyNewest = (historyNewest + 1) % CFG_HISTORY_SIZE;
+      strcpy(history[historyNewest], fileName);
+      if (historyCount < CFG_HISTORY_SIZE)
+        historyCount++;
+    }
+    historyBack = 0;
+  }
+
+  void Recall(uint8_t back)
+  {
+    // make the file back steps from the newest current
+    historyBack = back;
+    strcpy(fileName, history[(historyNewest + CFG_HISTORY_SIZE - back) % CFG_HISTORY_SIZE]);
+    haveFile = true;
+  }
+
+  bool HistoryNext()
+  {
+    // if stepped back, step forward through the history, true if it did
+    if (!historyBack)
+      return false;
+    Recall(historyBack - 1);
+    return true;
+  }
+
+  bool Back()
+  {
+    // step back to the previous file in the history, true if there is one
+    if (historyBack + 1 >= historyCount)
+      return false;
+    Recall(historyBack + 1);
+    return true;
+  }
+#else
+  void Remember()
+  {
+  }
+
+  bool HistoryNext()
+  {
+    return false;
+  }
+#endif
+
+#ifdef CFG_RANDOM_ORDER
+  // images cycle in pseudo-random order
+  uint32_t numberOfFiles = 0;
+  uint32_t previousN = 0;
+  uint32_t seed = 0; // generate some entropy from all the file names and seed the PRNG
+
+  uint32_t ScanFiles(uint32_t n)
+  {
+    // scan the directory counting files
+    // if n is non-zero, stops on the nth file (counting from 1)
+    // if n is 0, scans ALL files and, if not DEBUG, generates a PRNG seed from the names
+    // returns the number of files scanned
+    // 
+    uint32_t count = 0;
+    root = SD.open(CFG_IMAGE_FOLDER);
+    if (root)
+    {
+      while (count != n || n == 0)
+      {
+        File file = root.openNextFile();
+        if (file)
+        {
+          bool isSlide = !file.isDirectory(); // e.g. not the thumbnail folder
+          if (CheckFile(file) && isSlide)
+          {
+            count++;
+#ifndef DEBUG
+            if (n==0)
+              seed ^= NameAsSeed();
+#endif
+          }
+          file.close();
+        }
+        else
+          break;  // done
+      }
+      root.close();
+    }
+    return count;
+  }
+  
+  void FolderFirst()
+  {
+    // count the images, set the current image to the LAST
+    // if not DEBUG, seeds the PRNG
+    numberOfFiles = ScanFiles(0);
+    haveFile = numberOfFiles != 0;
+    previousN = numberOfFiles;
+#ifndef DEBUG
+    if (seed)
+      randomSeed(seed);
+#endif
+  }
+
+  void FolderNext()
+  {
+    // get a random file
+    haveFile = false;
+    if (numberOfFiles)
+    {
+      uint32_t n = random(numberOfFiles) + 1;
+      if (n == previousN) // make ONE attempt at avoiding duplicate
+        n = random(numberOfFiles) + 1;
+      previousN = n;
+      haveFile = ScanFiles(n) == n;
+    }
+  }
+#else
+  // images cycle in directory order
+  File OpenNextFile()
+  {
+    // the next file in root, skipping folders (e.g. the thumbnail folder)
+    File file = root.openNextFile();
+    while (file && file.isDirectory())
+    {
+      file.close();
+      file = root.openNextFile();
+    }
+    return file;
+  }
+
+  void FolderFirst()
+  {
+    // find the first image in the folder
+    root = SD.open(CFG_IMAGE_FOLDER);
+    File file = OpenNextFile();
+    CheckFile(file);
+  }
+
+  void FolderNext()
+  {
+    // find the next image in the folder
+    File file;
+    if (haveFile)
+    {
+      file = OpenNextFile();
+      if (!CheckFile(file))
+      {
+        // start again
+        haveFile = false;
+        root.close();
+        root = SD.open(CFG_IMAGE_FOLDER);
+        file = OpenNextFile();
+        CheckFile(file);
+      }
+    }
+  }
+#endif
+
+#ifdef CFG_PLAYLIST
+  // The optional playlist, CFG_PLAYLIST in the image folder. Each line is "<8.3 name> [<seconds>]", blank lines 
+  // and ones starting with # are skipped. It is read a line at a time from a saved offset, so any length needs no RAM.
+  bool playlist = false;        // there is one
+  uint32_t playlistOffset = 0;  // of the next line
+  uint16_t dwell = CFG_SECONDS_BETWEEN_IMAGES;
+
+  void PlaylistLine(char* pLine)
+  {
+    // make the file on a line of the playlist current, if there is one
+    char* pName = pLine + strspn(pLine, " \t");
+    size_t len = strcspn(pName, " \t\r");
+    if (!len || len >= sizeof(fileName) || *pName == '#')
+      return;
+    dwell = atoi(pName + len);
+    if (!dwell)
+      dwell = CFG_SECONDS_BETWEEN_IMAGES;
+    pName[len] = '\0';
+    strcpy(fileName, pName);
+    haveFile = true;
+  }
+
+  bool PlaylistNext()
+  {
+    // if there's a playlist, make its next entry current, going back to the start at the end
+    // true if there's a playlist
+    if (!playlist)
+      return false;
+    haveFile = false;
+    File file = SD.open(CFG_IMAGE_FOLDER CFG_PLAYLIST, FILE_READ);
+    Scratch::Scope scope;
+    char* pLine = (char*)scope.Take(kPathLen);
+    uint8_t wraps = 0;
+    while (file && !haveFile && wraps < 2)
+    {
+      file.seek(playlistOffset);
+      uint8_t len = 0;
+      int ch;
+      while ((ch = file.read()) != -1 && ch != '\n')
+        if (len < kPathLen - 1)
+          pLine[len++] = ch;
+      pLine[len] = '\0';
+      if (ch == -1 && !len)
+      {
+        // the end, start again
+        playlistOffset = 0;
+        wraps++;
+      }
+      else
+      {
+        playlistOffset = file.position();
+        PlaylistLine(pLine);
+      }
+    }
+    file.close();
+    return true;
+  }
+
+  bool PlaylistFirst()
+  {
+    // if there's a playlist, make its first entry current. true if there's a playlist
+    playlist = SD.exists(CFG_IMAGE_FOLDER CFG_PLAYLIST);
+    playlistOffset = 0;
+    return PlaylistNext();
+  }
+
+  uint16_t Dwell()
+  {
+    // seconds to show the current slide for
+    return playlist?dwell:CFG_SECONDS_BETWEEN_IMAGES;
+  }
+#else
+  bool PlaylistNext()
+  {
+    return false;
+  }
+
+  bool PlaylistFirst()
+  {
+    return false;
+  }
+
+  uint16_t Dwell()
+  {
+    // seconds to show the current slide for
+    return CFG_SECONDS_BETWEEN_IMAGES;
+  }
+#endif
+
+  void GetFirst()
+  {
+    // find the first image, from the playlist if there is one, else the folder
+    haveFile = false;
+    if (BeginSD() && !PlaylistFirst())
+      FolderFirst();
+    Remember();
+  }
+
+  void GetNext()
+  {
+    // find the next image, back through the history first if it was stepped back
+    if (HistoryNext())
+      return;
+    if (!PlaylistNext())
+      FolderNext();
+    Remember();
+  }
+
+  uint32_t ReadDWord(File& file)
+  {
+    // BMP is little-endian
+    uint32_t dw = 0;
+    for (uint32_t b = 0; b < 4; b++)
+    {
+      uint32_t temp = file.read();
+      dw |= temp << (8UL*b);
+    }
+    return dw;
+  }
+  
+  bool ExtractOriginalName(File& file, char* pName)
+  {
+    // original file name may be appended to .BMP as:
+    //  "NAME:=\r\n<name-with-extension> etc\r\n"
+    // built in pName, it's overwritten if this fails
+    uint32_t sig = 0;
+    int idx = 0;
+    // Is there an original name appended to the file?
+    // go back from EOF by: max len of name, plus start sig size, plus final \r\n, plus a fudge.
+    file.seek(file.size() - (SLIDE_APPENDED_TEXT_MAX_LEN + 8 + 2 + 2));
+    while (file.peek() != -1)
+    {
+      sig <<= 8;
+      sig |= file.read();
+      if (sig == 0x4E414D45UL && ReadDWord(file) == 0x0A0D3D3AUL) // "NAME" and ":=\r\n" (with different byte-order)
+      {
+        // start found, try building a string
+        while (file.peek() != -1)
+        {
+          char ch = file.read();
+          if (::isprint(ch))
+          {
+            if (idx < SLIDE_APPENDED_TEXT_MAX_LEN)
+              pName[idx++] = ch;
+            else
+              break;  // too long
+          }
+          else if (ch == '\r')
+          {
+            // found the end, done and good
+            pName[idx] = '\0';
+            return true;
+          }
+          else
+            break; // invalid char
+        }
+        break;
+      }
+    }
+    return false;
+  }
+
+  // the geometry of the current slide, set by ReadHeader
+  #define SLIDE_MAX_SCALE 4       // largest reduction factor
+  uint32_t DataOffset = 0;
+  uint32_t Width = 0;
+  uint32_t Height = 0;
+  uint32_t BPP = 0;
+  uint32_t RowSize = 0;
+  uint8_t Scale = 1;              // source pixels per painted pixel, each way
+  uint32_t StartRow = 0;          // first row & col painted, in scaled pixels
+  uint32_t StartCol = 0;
+  uint32_t PaintX = 0;            // where it's painted
+  uint32_t PaintY = 0;
+  uint32_t PaintWidth = 0;
+  uint32_t PaintHeight = 0;
+
+  // PaintCurrent calls pPoll every kPollRows rows, cheap enough between rows (it's in the gap between LCD writes)
+  const uint8_t kPollRows = 4;
+  PaintPoll pPoll = NULL;
+  uint8_t pollCtr = 0;
+  bool stopped = false; // pPoll asked to stop, the rest of the slide isn't painted
+
+  bool Polled()
+  {
+    // count a painted row, true once pPoll has asked to stop
+    if (++pollCtr == kPollRows)
+    {
+      pollCtr = 0;
+      stopped = pPoll && pPoll();
+    }
+    return stopped;
+  }
+
+  void Fit(uint32_t scaled, uint32_t pos, uint32_t size, uint32_t& start, uint32_t& paintPos, uint32_t& paintSize)
+  {
+    // centre a scaled dimension in a window dimension, clipping or leaving gaps either side
+    if (scaled < size)
+    {
+      start = 0;
+      paintPos = pos + (size - scaled) / 2;
+      paintSize = scaled;
+    }
+    else
+    {
+      start = (scaled - size) / 2;
+      paintPos = pos;
+      paintSize = size;
+    }
+  }
+
+  bool ReadHeader(File& file, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+  {
+    // reads the BMP header, sets up the geometry for painting into a window x, y, w, h
+    // returns true if the slide can be painted (valid bmp, no compression etc)
+    // BMP: https://www.ece.ualberta.ca/~elliott/ee552/studentAppNotes/2003_w/misc/bmp_file_format/bmp_file_format.htm
+    file.seek(0);
+    if (file.read() == 'B' && file.read() == 'M') // BMP Signature
+    {
+      file.seek(0x000A);
+      DataOffset = ReadDWord(file);
+      // InfoHeader
+      uint32_t Size = ReadDWord(file);
+      Width = ReadDWord(file);
+      Height = ReadDWord(file);
+      BPP = ReadDWord(file) >> 16;
+      file.seek(0x001E);
+      uint32_t Compression = ReadDWord(file); 
+      file.seek(0x0036);
+      uint32_t Palette0 = ReadDWord(file); 
+
+      if (Size == 40 &&                 // Version 3.x BMP
+        Width && Height &&              // any size, but not empty (or upside-down)
+        Height < 0x80000000UL &&
+#ifdef CFG_GREYSCALE_BITS
+        (BPP == 1 || BPP == 4) &&       // mono or 4BPP
+#else            
+        BPP == 1 &&                     // mono
+#endif            
+        Compression == 0 &&             // uncompressed
+        Palette0 == 0)                  // 0=black
+      {
+        // reduce by the smallest factor that fits it in at least one direction, the other is clipped.
+        // Not if it overshoots by under an eighth in either, cropping a few pixels beats gaps all round
+        Scale = 1;
+        while (Scale < SLIDE_MAX_SCALE && Width / Scale > w + w / 8 && Height / Scale > h + h / 8)
+          Scale++;
+        Fit(Width / Scale, x, w, StartCol, PaintX, PaintWidth);
+        Fit(Height / Scale, y, h, StartRow, PaintY, PaintHeight);
+
+        RowSize = (BPP*Width) / 8;
+        if ((BPP*Width) % 8)
+          RowSize++; // extra byte
+        if (RowSize % 4)
+          RowSize += (4 - (RowSize % 4)); // row is multiple of 4 bytes
+        return true;
+      }
+    }
+    return false;
+  }
+
+#ifdef CFG_DIFF_REPAINT
+  // what's on screen: a signature of each row of the window (0 is unknown) and of the gaps
+  uint16_t screenRows[SLIDE_MAX_HEIGHT];
+  uint16_t screenGaps = 0;
+  uint8_t diffs = 0;            // slides compared since every row was last repainted
+  // the slide being painted
+  uint16_t* pScreenRows = NULL; // the signatures of its rows, NULL if they aren't compared
+  uint16_t rowSeed = 0;         // what its rows' signatures start from
+  uint16_t rowSig = 0;          // of the row being painted, 0 if it's not known
+  bool pushing = true;          // false while a row that's already on screen is only being cached
+  bool reopen = false;          // a row was skipped, so the LCD window has lost its place
+
+  uint16_t SigAdd(uint16_t sig, uint32_t value, uint8_t bytes)
+  {
+    // add the low bytes of value to a Fletcher-style signature
+    uint8_t lo = sig;
+    uint8_t hi = sig >> 8;
+    while (bytes--)
+    {
+      lo += value;
+      hi += lo;
+      value >>= 8;
+    }
+    return (hi << 8) | lo;
+  }
+
+  uint16_t GapsSig(uint32_t x, uint32_t y)
+  {
+    // signature of where the gaps are in the window, never 0
+    uint16_t sig = SigAdd(0x4C50, PaintX - x, 2);
+    sig = SigAdd(sig, PaintY - y, 2);
+    sig = SigAdd(sig, PaintWidth, 2);
+    sig = SigAdd(sig, PaintHeight, 2);
+    return sig?sig:1;
+  }
+
+  void BeginDiff(uint32_t y, uint32_t h, bool compare)
+  {
+    // start comparing the slide's rows with the screen's as they're painted, or if not compare, forget them
+    rowSig = 0;
+    reopen = false;
+    pScreenRows = NULL;
+    if (!compare || h > SLIDE_MAX_HEIGHT)
+    {
+      memset(screenRows, 0, sizeof(screenRows));
+      return;
+    }
+    if (++diffs == CFG_DIFF_REFRESH)
+    {
+      // a changed row can match by chance (1 in 65536), now and then repaint them all so it doesn't stay
+      diffs = 0;
+      memset(screenRows, 0, sizeof(screenRows));
+    }
+    pScreenRows = screenRows + (PaintY - y);
+    rowSeed = SigAdd(GapsSig(0, y), StartCol, 4);
+    rowSeed = SigAdd(rowSeed, Scale, 1);
+    rowSeed = SigAdd(rowSeed, BPP, 1);
+    // rows entirely in the gaps match when the gaps do
+    for (uint16_t row = 0; row < h; row++)
+      if (row < PaintY - y || PaintY - y + PaintHeight <= row)
+        screenRows[row] = screenGaps;
+  }
+
+  bool RowChanged(uint16_t row)
+  {
+    // note rowSig as the signature of row on screen, true if it was different and the row needs painting
+    // the window is opened again after a skipped row, from this row to the bottom for a top-down paint
+    if (!pScreenRows)
+      return true;
+    bool same = rowSig && rowSig == pScreenRows[row];
+    pScreenRows[row] = rowSig;
+    if (same)
+    {
+      reopen = true;
+      return false;
+    }
+    if (reopen)
+    {
+      LCD_BEGIN_FILL(PaintX, PaintY + row, PaintWidth, PaintHeight - row);
+      reopen = false;
+    }
+    return true;
+  }
+#endif
+
+  void PaintGaps(uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+  {
+    // fill the gaps around a slide smaller than the window
+#ifdef CFG_DIFF_REPAINT
+    // unless they're already there
+    uint16_t sig = GapsSig(x, y);
+    if (sig == screenGaps)
+      return;
+    screenGaps = sig;
+#endif
+    if (PaintX > x)
+      LCD_FILL_RECT(x, y, PaintX - x, h, CFG_GAP_FILL_COLOUR); // left
+    if (PaintX + PaintWidth < x + w)
+      LCD_FILL_RECT(PaintX + PaintWidth, y, x + w - PaintX - PaintWidth, h, CFG_GAP_FILL_COLOUR); // right
+    if (PaintY > y)
+      LCD_FILL_RECT(PaintX, y, PaintWidth, PaintY - y, CFG_GAP_FILL_COLOUR); // top
+    if (PaintY + PaintHeight < y + h)
+      LCD_FILL_RECT(PaintX, PaintY + PaintHeight, PaintWidth, y + h - PaintY - PaintHeight, CFG_GAP_FILL_COLOUR); // bottom
+  }
+
+  uint16_t LevelColour(uint8_t level)
+  {
+    // grey level 0..15 as a colour, 0 is black, 15 is white
+    level |= level << 4;
+    return RGB(level, level, level);
+  }
+
+  void PushRun(uint16_t n, uint8_t level)
+  {
+    // paint n pixels of a grey level 0..15 into the current window
+#ifdef CFG_DIFF_REPAINT
+    if (!pushing)
+      return; // the row's already on screen
+#endif
+    STATS_START(STATS_LCD)
+    LCD_FILL_COLOUR(n, LevelColour(level));
+    STATS_STOP(STATS_LCD)
+  }
+
+#ifdef CFG_SLIDE_CACHE_FOLDER
+  // Transcoded copies of slides.
+  // A cache file is a CacheHeader followed by the rows, top-down and pre-clipped, each as
+  //  with CFG_DIFF_REPAINT the row's signature <lo, hi> (0 if not known),
+  //  then runs of <level:4,count:4> (count 0 means the count is in the next byte)
+  //  until the row is PaintWidth pixels. A slide being cached is painted top-down, so it's written in order.
+#ifdef CFG_DIFF_REPAINT
+  #define CACHE_MAGIC 0x3244504CUL // "LPD2" (written last, once the file is complete)
+#else
+  #define CACHE_MAGIC 0x3243504CUL // "LPC2" (written last, once the file is complete)
+#endif
+  struct CacheHeader
+  {
+    uint32_t magic;
+    uint32_t sourceSize;  // source file size, and...
+    uint16_t sourceSig;   // ...a checksum of a sample of it, to spot changes
+    uint16_t height;      // of the window
+    uint16_t paintLeft;   // PaintX & PaintY, relative to the window
+    uint16_t paintTop;
+    uint16_t paintWidth;
+    uint16_t paintHeight;
+    char name[SLIDE_APPENDED_TEXT_MAX_LEN + 1];
+  };
+
+  File cacheFile; // open while a slide is being transcoded
+  bool caching = false;
+  // the cache is written CFG_SLIDE_CACHE_BUFFER bytes at a time (and read back through the same buffer)
+  uint8_t cacheBuffer[CFG_SLIDE_CACHE_BUFFER];
+  uint16_t cacheUsed = 0;
+
+  void CachePut(uint8_t b)
+  {
+    // add a byte to the cache file
+    if (cacheUsed == sizeof(cacheBuffer))
+    {
+      cacheFile.write(cacheBuffer, cacheUsed);
+      cacheUsed = 0;
+    }
+    cacheBuffer[cacheUsed++] = b;
+  }
+
+  void CacheRun(uint16_t n, uint8_t level)
+  {
+    // add a run of n pixels of level to the cache file
+    level <<= 4;
+    while (n)
+    {
+      uint8_t count = (n > 255)?255:n;
+      if (count <= 0x0F)
+        CachePut(level | count);
+      else
+      {
+        CachePut(level);
+        CachePut(count);
+      }
+      n -= count;
+    }
+  }
+
+  uint16_t SourceSignature(File& file)
+  {
+    // a checksum of a sample from the middle of the file (the SD library doesn't expose file dates)
+    uint8_t sum1 = 0, sum2 = 0;
+    file.seek(file.size() / 2);
+    for (uint8_t ctr = 0; ctr < 64; ctr++)
+    {
+      sum1 += file.read();
+      sum2 += sum1;
+    }
+    return (sum2 << 8) | sum1;
+  }
+
+  void CachePath(char* pPath)
+  {
+    // path of the cached copy of the current file
+    strcpy(pPath, CFG_SLIDE_CACHE_FOLDER);
+    strcat(pPath, fileName);
+  }
+
+  void CacheBegin(const CacheHeader& header)
+  {
+    // start writing the cached copy of the current file
+    Scratch::Scope scope;
+    char* pPath = (char*)scope.Take(kPathLen);
+    CachePath(pPath);
+    cacheFile = SD.open(pPath, O_WRITE | O_CREAT | O_TRUNC);
+    caching = cacheFile;
+    cacheUsed = 0;
+    if (caching)
+    {
+      const uint8_t* pHeader = (const uint8_t*)&header;
+      for (uint8_t b = 0; b < sizeof(header); b++)
+        CachePut(*pHeader++);
+    }
+  }
+
+  void CacheEnd(bool complete)
+  {
+    // finish writing the cached copy, mark it as complete if it is
+    // (an incomplete one is left unmarked, so it's ignored and rewritten next time)
+    if (caching)
+    {
+      if (complete)
+      {
+        cacheFile.write(cacheBuffer, cacheUsed);
+        uint32_t magic = CACHE_MAGIC;
+        cacheFile.seek(0);
+        cacheFile.write((const uint8_t*)&magic, sizeof(magic));
+      }
+      cacheFile.close();
+      caching = false;
+    }
+  }
+
+  bool PaintFromCache(const CacheHeader& header, uint32_t x, uint32_t y, uint32_t w, uint32_t h, char* pName)
+  {
+    // paint the slide from its cached copy, if it's there and still matches the source
+    Scratch::Scope scope;
+    char* pPath = (char*)scope.Take(kPathLen);
+    CachePath(pPath);
+    File cache = SD.open(pPath, FILE_READ);
+    if (!cache)
+      return false;
+    CacheHeader cached;
+    bool result = cache.read(&cached, sizeof(cached)) == sizeof(cached) &&
+                  cached.magic == CACHE_MAGIC &&
+                  cached.sourceSize == header.sourceSize &&
+                  cached.sourceSig == header.sourceSig &&
+                  cached.height == h &&
+                  cached.paintLeft + cached.paintWidth <= w &&
+                  cached.paintTop + cached.paintHeight <= h;
+    if (result)
+    {
+      PaintX = x + cached.paintLeft;
+      PaintY = y + cached.paintTop;
+      PaintWidth = cached.paintWidth;
+      PaintHeight = cached.paintHeight;
+      PaintGaps(x, y, w, h);
+#ifdef CFG_DIFF_REPAINT
+      // the rows' signatures are cached with them
+      BeginDiff(y, h, true);
+      uint8_t sigBytes = 2; // the first row's is next
+#endif
+      // read the rows through the (idle) write buffer, top-down into one window
+      LCD_BEGIN_FILL(PaintX, PaintY, PaintWidth, PaintHeight);
+      uint16_t avail = 0;
+      uint8_t* pByte = cacheBuffer;
+      uint16_t row = 0;
+      uint16_t col = 0;
+      uint8_t level = 0;
+      bool longRun = false;
+      while (row < PaintHeight)
+      {
+        if (!avail)
+        {
+          STATS_START(STATS_READ)
+          int len = cache.read(cacheBuffer, sizeof(cacheBuffer));
+          STATS_STOP(STATS_READ)
+          if (len <= 0)
+          {
+            result = false; // truncated
+            break;
+          }
+          STATS_BYTES(len)
+          avail = len;
+          pByte = cacheBuffer;
+        }
+        uint8_t b = *pByte++;
+        avail--;
+#ifdef CFG_DIFF_REPAINT
+        if (sigBytes)
+        {
+          // the row's signature, lo then hi. It's not painted if it's already on screen
+          rowSig = (rowSig >> 8) | (b << 8);
+          if (!--sigBytes)
+            pushing = RowChanged(row);
+          continue;
+        }
+#endif
+        if (longRun)
+        {
+          // count of a long run
+          PushRun(b, level);
+          col += b;
+          longRun = false;
+        }
+        else if (b & 0x0F)
+        {
+          // short run
+          PushRun(b & 0x0F, b >> 4);
+          col += b & 0x0F;
+        }
+        else
+        {
+          // long run, count follows
+          level = b >> 4;
+          longRun = true;
+          continue;
+        }
+        if (col >= PaintWidth)
+        {
+          row++;
+          col = 0;
+#ifdef CFG_DIFF_REPAINT
+          sigBytes = 2;
+#endif
+          if (Polled())
+            break; // the slide's still the current one, it's just not all shown
+        }
+      }
+#ifdef CFG_DIFF_REPAINT
+      pushing = true;
+#endif
+      if (result)
+        strcpy(pName, cached.name);
+    }
+    cache.close();
+    return result;
+  }
+#endif
+
+  void EmitRun(uint16_t n, uint8_t level)
+  {
+    // paint n pixels of a grey level 0..15, and cache them
+    if (!n)
+      return;
+    PushRun(n, level);
+#ifdef CFG_SLIDE_CACHE_FOLDER
+    if (caching && !Transitions::Replicating) // a replicated row has no row header of its own
+      CacheRun(n, level);
+#endif
+  }
+
+  // reads the source pixels of a row
+  File slide;     // the open slide
+  uint16_t sectorsRead = 0;
+  uint32_t lastSector = 0;
+  uint8_t Values[4];
+  uint8_t* pReads = Values; // what the row is read into (PaintCurrent lends a bigger one)
+  uint8_t readSize = sizeof(Values);
+  uint16_t rowLeft = 0;     // bytes of the row still to read
+  uint8_t* pValue;
+  uint8_t ctr = 0;
+  uint8_t Byte;   // current source byte
+  uint8_t Mask;   // current pixel in Byte
+#ifdef CFG_DIFF_REPAINT
+  bool rowRead = false;     // DiffRow has already read the start of the row
+#endif
+
+  void CountSector(uint32_t position)
+  {
+    // count sectors as reads move between them
+    uint32_t sector = position >> 9;
+    if (sector != lastSector)
+    {
+      sectorsRead++;
+      lastSector = sector;
+    }
+  }
+
+  void ReadSource()
+  {
+    // read as much of the rest of the row as fits, faster paint
+    ctr = (rowLeft < readSize)?rowLeft:readSize;
+    rowLeft -= ctr;
+    STATS_START(STATS_READ)
+    CountSector(slide.position());
+    slide.read(pReads, ctr);
+    CountSector(slide.position() - 1);
+    STATS_STOP(STATS_READ)
+    STATS_BYTES(ctr)
+    pValue = pReads;
+  }
+
+  inline uint8_t NextSourceByte()
+  {
+    // the next byte of the row
+    if (!ctr)
+    {
+      if (!rowLeft)
+        return 0; // only ever fetched ahead, not used
+      ReadSource();
+    }
+    ctr--;
+    return *pValue++;
+  }
+
+  void SeekSourceRow(uint32_t srcRow, uint32_t srcCol, uint32_t srcPixels)
+  {
+    // position at srcCol in srcRow (0 is the top), to read srcPixels, and read the start of it
+    // rows are in reverse order
+    slide.seek(DataOffset + (Height - srcRow - 1) * RowSize + (srcCol * BPP) / 8);
+    rowLeft = ((srcCol + srcPixels) * BPP + 7) / 8 - (srcCol * BPP) / 8;
+    ReadSource();
+  }
+
+  void BeginSourceRow(uint32_t srcRow, uint32_t srcCol, uint32_t srcPixels)
+  {
+    // start reading srcPixels from srcCol in srcRow (0 is the top)
+#ifdef CFG_DIFF_REPAINT
+    if (rowRead)
+      rowRead = false; // DiffRow read it
+    else
+#endif
+      SeekSourceRow(srcRow, srcCol, srcPixels);
+    Byte = NextSourceByte();
+    if (BPP == 1)
+      Mask = 0x80 >> (srcCol % 8);
+    else
+      Mask = (srcCol % 2)?0x0F:0xF0;
+  }
+
+  uint8_t NextSourceLevel()
+  {
+    // the next pixel of the row as a grey level 0..15
+    uint8_t level;
+    if (BPP == 1)
+    {
+      level = (Byte & Mask)?0x0F:0x00; // 1 is white, 0 is black 
+      Mask >>= 1;
+    }
+    else
+    {
+      level = Byte & Mask;
+      if (Mask == 0xF0)
+      {
+        level >>= 4;
+        Mask = 0x0F;
+      }
+      else
+        Mask = 0x00;
+    }
+    if (!Mask)
+    {
+      Mask = (BPP == 1)?0x80:0xF0;
+      Byte = NextSourceByte();
+    }
+    return level;
+  }
+
+  // runs of the same level are painted together
+  uint8_t runLevel = 0;
+  uint16_t runLength = 0;
+
+  inline void AddPixels(uint8_t level, uint8_t n)
+  {
+    // add n pixels of level to the current run
+    if (level != runLevel)
+    {
+      EmitRun(runLength, runLevel);
+      runLevel = level;
+      runLength = 0;
+    }
+    runLength += n;
+  }
+
+  uint8_t ReduceLevel(uint8_t level)
+  {
+#ifdef CFG_GREYSCALE_BITS
+    // reduce grey values, 4, 2 or 1
+    const uint8_t shift = 4 - CFG_GREYSCALE_BITS;
+    level >>= shift;
+    level <<= shift;
+#endif
+    return level;
+  }
+
+  inline void RecordRow()
+  {
+    // note the start of a row in the cached copy
+#if defined(CFG_SLIDE_CACHE_FOLDER) && defined(CFG_DIFF_REPAINT)
+    if (caching && !Transitions::Replicating) // only the first paint of a row
+    {
+      CachePut(rowSig);
+      CachePut(rowSig >> 8);
+    }
+#endif
+  }
+
+  void PaintRow(uint16_t row, uint16_t col, uint16_t pixels)
+  {
+    // paint pixels from col in one row of the slide (0 is the top) into the current window
+    // if reduced, only the middle source row of each Scale rows is read. 
+    // Each painted pixel is the average (grey) or majority (mono) of Scale source pixels
+    RecordRow();
+    BeginSourceRow((StartRow + row) * Scale + Scale / 2, (StartCol + col) * Scale, pixels * Scale);
+    runLevel = 0;
+    runLength = 0;
+    for (; pixels; pixels--)
+    {
+      uint8_t level = 0;
+      for (uint8_t s = 0; s < Scale; s++)
+        level += NextSourceLevel();
+      if (BPP == 1)
+        level = (2 * level >= 0x0F * Scale)?0x0F:0x00;
+      else
+        level = ReduceLevel(level / Scale);
+      AddPixels(level, 1);
+    }
+    EmitRun(runLength, runLevel);
+  }
+
+  template<uint8_t BITS> void AddBits(uint8_t byte, uint8_t mask, uint8_t pixels)
+  {
+    // add pixels from byte, starting at mask
+    for (; pixels; pixels--)
+    {
+      if (BITS == 1)
+      {
+        AddPixels((byte & mask)?0x0F:0x00, 1);
+        mask >>= 1;
+      }
+      else
+      {
+        AddPixels(ReduceLevel((mask == 0xF0)?(byte >> 4):(byte & 0x0F)), 1);
+        mask = 0x0F;
+      }
+    }
+  }
+
+  template<uint8_t BITS, bool CLIP> void PaintRowUnscaled(uint16_t row, uint16_t col, uint16_t pixels)
+  {
+    // paint pixels from col in one row of an unscaled slide, specialised for the pixel size and for 
+    // clipping into the middle of a source byte. Works on whole source bytes, no per-pixel clip tests.
+    const uint8_t kPixelsPerByte = 8 / BITS;
+    RecordRow();
+    BeginSourceRow(StartRow + row, StartCol + col, pixels);
+    runLevel = 0;
+    runLength = 0;
+    if (CLIP)
+    {
+      // the partial first byte (col is a multiple of 8, it doesn't change the alignment)
+      uint8_t lead = kPixelsPerByte - StartCol % kPixelsPerByte;
+      if (lead > pixels)
+        lead = pixels;
+      AddBits<BITS>(Byte, Mask, lead);
+      pixels -= lead;
+      Byte = NextSourceByte();
+    }
+    for (uint8_t bytes = pixels / kPixelsPerByte; bytes; bytes--)
+    {
+      if (BITS == 1)
+      {
+        if (Byte == 0x00)
+          AddPixels(0x00, 8);
+        else if (Byte == 0xFF)
+          AddPixels(0x0F, 8);
+        else
+          AddBits<BITS>(Byte, 0x80, 8);
+      }
+      else
+      {
+        uint8_t hi = ReduceLevel(Byte >> 4);
+        uint8_t lo = ReduceLevel(Byte & 0x0F);
+        if (hi == lo)
+          AddPixels(hi, 2);
+        else
+        {
+          AddPixels(hi, 1);
+          AddPixels(lo, 1);
+        }
+      }
+      Byte = NextSourceByte();
+    }
+    // the partial last byte
+    AddBits<BITS>(Byte, (BITS == 1)?0x80:0xF0, pixels % kPixelsPerByte);
+    EmitRun(runLength, runLevel);
+  }
+
+  Transitions::PaintSpan PickPainter()
+  {
+    // the row painter for the slide's format, chosen once
+    if (Scale > 1)
+      return PaintRow;
+    else if (BPP == 1)
+    {
+      if (StartCol % 8)
+        return PaintRowUnscaled<1, true>;
+      else
+        return PaintRowUnscaled<1, false>;
+    }
+#ifdef CFG_GREYSCALE_BITS
+    else if (StartCol % 2)
+      return PaintRowUnscaled<4, true>;
+    else
+      return PaintRowUnscaled<4, false>;
+#else
+    return PaintRow;
+#endif
+  }
+
+  Transitions::PaintSpan pPainter = NULL; // what PolledRow paints with
+
+#ifdef CFG_DIFF_REPAINT
+  void DiffRow(uint16_t row, uint16_t col, uint16_t pixels)
+  {
+    // paint a whole row with pPainter, unless it's already on screen. The row is read into the read
+    // buffer and, if it all fits, its signature compared before any of it is painted
+    if (!pScreenRows)
+    {
+      pPainter(row, col, pixels);
+      return;
+    }
+    SeekSourceRow((StartRow + row) * Scale + Scale / 2, StartCol * Scale, PaintWidth * Scale);
+    rowRead = true;
+    rowSig = 0;
+    if (!rowLeft)
+    {
+      rowSig = rowSeed;
+      for (uint8_t b = 0; b < ctr; b++)
+        rowSig = SigAdd(rowSig, pReads[b], 1);
+      if (!rowSig)
+        rowSig = 1;
+    }
+    if (RowChanged(row))
+      pPainter(row, col, pixels);
+#ifdef CFG_SLIDE_CACHE_FOLDER
+    else if (caching)
+    {
+      // the cached copy still needs it
+      pushing = false;
+      pPainter(row, col, pixels);
+      pushing = true;
+    }
+#endif
+    else
+      rowRead = false;
+  }
+#endif
+
+  void PolledRow(uint16_t row, uint16_t col, uint16_t pixels)
+  {
+    // paint a row with pPainter, and end the reveal once pPoll asks
+#ifdef CFG_DIFF_REPAINT
+    DiffRow(row, col, pixels);
+#else
+    pPainter(row, col, pixels);
+#endif
+    Transitions::Stopped = Polled();
+  }
+
+#ifdef CFG_DIFF_REPAINT
+  void Invalidate()
+  {
+    // something else has drawn in the window, repaint it all next time
+    memset(screenRows, 0, sizeof(screenRows));
+    screenGaps = 0;
+  }
+#else
+  void Invalidate()
+  {
+  }
+#endif
+
+  void GetCaption(File& file, char* pName)
+  {
+    // the caption for the slide, the appended name or the file name
+#ifdef CFG_READ_IMAGE_NAME          
+    if (!ExtractOriginalName(file, pName))
+#endif
+      strcpy(pName, file.name());
+
+#ifndef CFG_SHOW_IMAGE_EXT
+    if (*pName && strlen(pName) > 4 && *(pName + strlen(pName) - 4) == '.')
+      *(pName + strlen(pName) - 4) = '\0'; // zap the extension
+#endif
+#ifdef CFG_LOWERCASE_IMAGE_NAME
+    char*pCtr = pName;
+    while (*pName)
+      *pName = ::tolower(*pName++);
+#endif
+  }
+
+  bool OpenSlide()
+  {
+    // open the current file as slide
+    Scratch::Scope scope;
+    char* pPath = (char*)scope.Take(kPathLen);
+    strcpy(pPath, CFG_IMAGE_FOLDER);
+    strcat(pPath, fileName);
+    STATS_START(STATS_OPEN)
+    slide = SD.open(pPath, FILE_READ);
+    STATS_STOP(STATS_OPEN)
+    return slide;
+  }
+
+  bool PaintCurrent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, char* pName, PaintPoll pPoll)
+  {
+    // draws current BMP into a window x, y, w, h and fills-in pName
+    // returns true if successful (valid bmp, no compression etc)
+    // pPoll, if any, is called every few rows and can stop the painting. The slide stays current, 
+    // partly painted, and isn't cached
+    strcpy(pName, "");
+    bool result = false;
+    Slides::pPoll = pPoll;
+    pollCtr = 0;
+    stopped = false;
+    if (haveFile)
+    {
+      // provide the name of potentially bad file
+      strcpy(pName, fileName);
+      strcat(pName, "?");
+      if (!OpenSlide())
+        return result;
+
+#ifdef CFG_SLIDE_CACHE_FOLDER
+      CacheHeader header;
+      memset(&header, 0, sizeof(header));
+      header.sourceSize = slide.size();
+      header.sourceSig = SourceSignature(slide);
+      header.height = h;
+      if (PaintFromCache(header, x, y, w, h, pName))
+      {
+        slide.close();
+        return true;
+      }
+#endif
+      STATS_START(STATS_HEADER)
+      bool valid = ReadHeader(slide, x, y, w, h);
+      STATS_STOP(STATS_HEADER)
+      if (valid)
+      {
+        // the rest of the scratch block is the read buffer, bar room for the cache's path
+        Scratch::Scope scope;
+        uint16_t reads = scope.Left();
+#ifdef CFG_SLIDE_CACHE_FOLDER
+        reads -= kPathLen;
+#endif
+        readSize = (reads < 0xFF)?reads:0xFF;
+        pReads = (uint8_t*)scope.Take(readSize);
+        STATS_START(STATS_NAME)
+        GetCaption(slide, pName);
+        STATS_STOP(STATS_NAME)
+        uint8_t transition = Transitions::Pick();
+        // PaintGaps() first, the row signatures depend on what it leaves on screen
+        PaintGaps(x, y, w, h);
+#ifdef CFG_SLIDE_CACHE_FOLDER
+        header.paintLeft = PaintX - x;
+        header.paintTop = PaintY - y;
+        header.paintWidth = PaintWidth;
+        header.paintHeight = PaintHeight;
+        strcpy(header.name, pName);
+        CacheBegin(header);
+        if (caching)
+          transition = TRANSITION_NONE; // the copy's written as it's painted, top-down
+#endif
+#ifdef CFG_DIFF_REPAINT
+        // rows the same as the screen's are skipped as they're read, if each is painted once, whole
+        BeginDiff(y, h, Transitions::RowsOnly(transition) && transition != TRANSITION_PROGRESSIVE);
+#endif
+        pPainter = PickPainter();
+        uint32_t startMS = millis();
+        sectorsRead = 0;
+        uint32_t coverageMS = Transitions::Reveal(transition, PaintX, PaintY, PaintWidth, PaintHeight, PolledRow);
+        if (!stopped)
+          Transitions::Record(transition, sectorsRead, coverageMS, millis() - startMS);
+#ifdef CFG_SLIDE_CACHE_FOLDER
+        CacheEnd(!stopped);
+#endif
+        pReads = Values; // the scope's ending
+        readSize = sizeof(Values);
+        result = true;
+      }
+      slide.close();
+    }
+    return result;
+  }
+
+#ifdef CFG_FATBITS
+  uint32_t Offset(uint32_t v, uint32_t pos, uint32_t size)
+  {
+    // v as an offset in pos..pos+size-1, clamped to it
+    if (v < pos)
+      return 0;
+    else if (v >= pos + size)
+      return size - 1;
+    return v - pos;
+  }
+
+  void FitZoomed(uint32_t centre, uint32_t zoomed, uint32_t pos, uint32_t size, uint32_t& start, uint32_t& paintPos, uint32_t& paintSize)
+  {
+    // like Fit(), but if it's clipped it is centred on centre, as far as it can be
+    Fit(zoomed, pos, size, start, paintPos, paintSize);
+    if (zoomed > size)
+    {
+      start = (centre > size / 2)?centre - size / 2:0;
+      if (start > zoomed - size)
+        start = zoomed - size;
+    }
+  }
+
+  void PaintZoomedRow(uint32_t srcRow, uint32_t start, uint8_t zoom)
+  {
+    // paint PaintWidth pixels of source row srcRow from start (in zoomed pixels), each source pixel zoom wide
+    BeginSourceRow(srcRow, start / zoom, (start + PaintWidth + zoom - 1) / zoom - start / zoom);
+    runLevel = 0;
+    runLength = 0;
+    uint8_t n = zoom - start % zoom; // the first pixel may be clipped
+    for (uint16_t pixels = PaintWidth; pixels; pixels -= n, n = zoom)
+    {
+      if (n > pixels)
+        n = pixels;
+      uint8_t level = NextSourceLevel();
+      if (BPP != 1)
+        level = ReduceLevel(level);
+      AddPixels(level, n);
+    }
+    EmitRun(runLength, runLevel);
+  }
+
+  bool PaintZoomed(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t cx, uint32_t cy, uint8_t zoom)
+  {
+    // draws the current slide into a window x, y, w, h with each source pixel zoom x zoom, centred on the 
+    // point cx, cy of it as PaintCurrent painted it. Each source row fills one window of its zoom rows
+    // returns true if successful
+    bool result = false;
+    if (haveFile && OpenSlide())
+    {
+      if (ReadHeader(slide, x, y, w, h))
+      {
+        // the source pixel at cx, cy
+        cx = (StartCol + Offset(cx, PaintX, PaintWidth)) * Scale;
+        cy = (StartRow + Offset(cy, PaintY, PaintHeight)) * Scale;
+        uint32_t startX, startY;
+        FitZoomed(cx * zoom, Width * zoom, x, w, startX, PaintX, PaintWidth);
+        FitZoomed(cy * zoom, Height * zoom, y, h, startY, PaintY, PaintHeight);
+        Invalidate();
+        PaintGaps(x, y, w, h);
+        uint32_t srcRow = startY / zoom;
+        uint8_t rows = zoom - startY % zoom; // the first row may be clipped
+        for (uint16_t row = 0; row < PaintHeight; row += rows, rows = zoom, srcRow++)
+        {
+          if (rows > PaintHeight - row)
+            rows = PaintHeight - row;
+          LCD_BEGIN_FILL(PaintX, PaintY + row, PaintWidth, rows);
+          for (uint8_t r = 0; r < rows; r++)
+            PaintZoomedRow(srcRow, startX, zoom);
+        }
+        result = true;
+      }
+      slide.close();
+    }
+    return result;
+  }
+#endif
+
+#ifdef CFG_THUMBNAIL_FOLDER
+  // Thumbnails are made by make_slides.bat, a file with the slide's name in CFG_THUMBNAIL_FOLDER holding
+  // SLIDE_THUMB_W x SLIDE_THUMB_H 1BPP pixels, top-down, 1 is white, no header. Read as many rows at a time
+  // as fit in the scratch block.
+  #define THUMB_ROW_BYTES ((SLIDE_THUMB_W + 7) / 8)
+
+  bool NextSlideName(File& folder, char* pName)
+  {
+    // copy the name of the next file (not folder) in folder to pName, false at the end
+    while (true)
+    {
+      File file = folder.openNextFile();
+      if (!file)
+        return false;
+      bool isSlide = !file.isDirectory();
+      if (isSlide)
+        strcpy(pName, file.name());
+      file.close();
+      if (isSlide)
+        return true;
+    }
+  }
+
+  void PaintThumbnail(uint16_t x, uint16_t y, const char* pName)
+  {
+    // paint the thumbnail of slide pName at x, y, grey if there isn't one
+    Scratch::Scope scope;
+    char* pPath = (char*)scope.Take(kPathLen);
+    strcpy(pPath, CFG_THUMBNAIL_FOLDER);
+    strcat(pPath, pName);
+    File thumb = SD.open(pPath, FILE_READ);
+    if (!thumb || thumb.size() != THUMB_ROW_BYTES * SLIDE_THUMB_H)
+    {
+      thumb.close();
+      LCD_FILL_RECT(x, y, SLIDE_THUMB_W, SLIDE_THUMB_H, LevelColour(0x0C));
+      return;
+    }
+    uint8_t rows = scope.Left() / THUMB_ROW_BYTES; // read at a time
+    if (rows > SLIDE_THUMB_H)
+      rows = SLIDE_THUMB_H;
+    uint8_t* pRows = (uint8_t*)scope.Take(rows * THUMB_ROW_BYTES);
+    // runs of the same colour are filled together, across rows too
+    LCD_BEGIN_FILL(x, y, SLIDE_THUMB_W, SLIDE_THUMB_H);
+    const uint8_t* pRow = pRows;
+    bool white = false;
+    uint16_t run = 0;
+    for (uint8_t row = 0; row < SLIDE_THUMB_H; row++)
+    {
+      if (!(row % rows))
+      {
+        uint8_t n = (SLIDE_THUMB_H - row < rows)?SLIDE_THUMB_H - row:rows;
+        thumb.read(pRows, n * THUMB_ROW_BYTES);
+        pRow = pRows;
+      }
+      for (uint8_t col = 0; col < SLIDE_THUMB_W; col++)
+      {
+        bool bit = pRow[col / 8] & (0x80 >> (col % 8));
+        if (bit != white)
+        {
+          if (run)
+            LCD_FILL_COLOUR(run, white?LCD_WHITE:LCD_BLACK);
+          white = bit;
+          run = 0;
+        }
+        run++;
+      }
+      pRow += THUMB_ROW_BYTES;
+    }
+    LCD_FILL_COLOUR(run, white?LCD_WHITE:LCD_BLACK);
+    thumb.close();
+  }
+
+  uint16_t PaintThumbnails(uint16_t first, uint16_t stride, uint16_t count, uint16_t x, uint16_t y, uint8_t columns, uint16_t dx, uint16_t dy)
+  {
+    // paint the thumbnails of up to count slides, the first (counting from 0, in folder order) and every stride'th 
+    // one after it, in columns from x, y, spaced dx, dy. Returns the number painted
+    uint16_t painted = 0;
+    File folder = SD.open(CFG_IMAGE_FOLDER);
+    if (folder)
+    {
+      Scratch::Scope scope;
+      char* pName = (char*)scope.Take(8 + 1 + 3 + 1);
+      uint16_t index = 0;
+      while (painted < count && NextSlideName(folder, pName))
+      {
+        if (index >= first && (index - first) % stride == 0)
+        {
+          PaintThumbnail(x + (painted % columns) * dx, y + (painted / columns) * dy, pName);
+          painted++;
+        }
+        index++;
+      }
+      folder.close();
+    }
+    return painted;
+  }
+
+  void Select(uint16_t index)
+  {
+    // make the slide at index (counting from 0, in folder order) the current one
+#ifdef CFG_RANDOM_ORDER
+    previousN = index + 1;
+    haveFile = ScanFiles(previousN) == previousN;
+#else
+    // the folder is left open after it, so GetNext() carries on from there
+    haveFile = false;
+    root.close();
+    root = SD.open(CFG_IMAGE_FOLDER);
+    if (root)
+    {
+      index++;
+      while (index && NextSlideName(root, fileName))
+        index--;
+      haveFile = !index;
+    }
+#endif
+    Remember();
+  }
+#endif
+
+  uint32_t NameAsSeed()
+  {
+    // return the first 4 chars of the current filename as a uint32_t (for entropy)
+    return *((uint32_t*)fileName);
+  }
+
+};
@@ -1,12 +1,25 @@
-#pragma once
-
-// Image file IO and rendering
-#define SLIDE_APPENDED_TEXT_MAX_LEN 40 // Max len of appended string. See make_slides.bat
-
-namespace Slides
-{
-  void GetFirst();
-  void GetNext();
-  bool PaintCurrent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, char* pName);
-  uint32_t NameAsSeed();
-};
+#pragma once
+
+// Image file IO and rendering
+#define SLIDE_APPENDED_TEXT_MAX_LEN 40 // Max len of appended string. See make_slides.bat
+#define SLIDE_MAX_HEIGHT 218 // Tallest window whose rows CFG_DIFF_REPAINT tracks
+#define SLIDE_THUMB_W 48 // Size of thumbnails. See make_slides.bat
+#define SLIDE_THUMB_H 27
+
+namespace Slides
+{
+  // Called between rows while a slide paints, true to stop painting it. See PaintCurrent
+  typedef bool (*PaintPoll)();
+
+  void GetFirst();
+  void GetNext();
+  bool Back();
+  uint16_t Dwell();
+  bool PaintCurrent(uint32_t x, uint32_t y, uint32_t w, uint32_t h, char* pName, PaintPoll pPoll = NULL);
+  uint32_t NameAsSeed();
+  bool PaintZoomed(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t cx, uint32_t cy, uint8_t zoom);
+  void Invalidate();
+  uint16_t LevelColour(uint8_t level);
+  uint16_t PaintThumbnails(uint16_t first, uint16_t stride, uint16_t count, uint16_t x, uint16_t y, uint8_t columns, uint16_t dx, uint16_t dy);
+  void Select(uint16_t index);
+};
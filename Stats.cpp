@@ -0,0 +1,112 @@
+#include <Arduino.h>
+#include "Config.h"
+#include "Stats.h"
+
+#ifdef CFG_STATS
+// Each phase's time is totalled over a slide, then the slide's totals go into the min, max and mean
+namespace Stats
+{
+  #define MSTR(_s) _s "\0"
+  static const char pNames[] PROGMEM = MSTR("scan") MSTR("open") MSTR("hdr") MSTR("name") MSTR("read") MSTR("lcd") MSTR("title");
+
+  struct Phase
+  {
+    uint32_t lastUS; // the last slide's
+    uint32_t minUS;
+    uint32_t maxUS;
+    uint32_t totalMS;
+    uint16_t totalUS; // over the whole ms, carried so the mean isn't biased low
+  };
+  Phase phases[STATS_COUNT];
+  uint32_t slideUS[STATS_COUNT]; // the slide so far
+  uint32_t slideBytes = 0;
+  uint32_t lastBytes = 0;
+  uint32_t totalKB = 0;
+  uint16_t totalBytes = 0; // over the whole KB, carried
+  uint16_t slides = 0;
+
+  void Add(uint8_t phase, uint32_t us)
+  {
+    // count us more of phase in this slide
+    slideUS[phase] += us;
+  }
+
+  void EndSlide()
+  {
+    // the slide's shown, add its times to the stats
+    for (uint8_t phase = 0; phase < STATS_COUNT; phase++)
+    {
+      Phase& stats = phases[phase];
+      uint32_t us = slideUS[phase];
+      stats.lastUS = us;
+      if (!slides || us < stats.minUS)
+        stats.minUS = us;
+      if (us > stats.maxUS)
+        stats.maxUS = us;
+      us += stats.totalUS;
+      stats.totalMS += us / 1000;
+      stats.totalUS = us % 1000;
+      slideUS[phase] = 0;
+    }
+    lastBytes = slideBytes;
+    slideBytes += totalBytes;
+    totalKB += slideBytes / 1024;
+    totalBytes = slideBytes % 1024;
+    slideBytes = 0;
+    slides++;
+  }
+
+  char* Append(char* pStr, uint32_t n)
+  {
+    // n in decimal at pStr, returns its end
+    char digits[10];
+    uint8_t count = 0;
+    do
+    {
+      digits[count++] = '0' + n % 10;
+      n /= 10;
+    } while (n);
+    while (count)
+      *pStr++ = digits[--count];
+    *pStr = '\0';
+    return pStr;
+  }
+
+  void Format(char* pStr)
+  {
+    // the last slide's times in ms, and the KB read, in STATS_FORMAT_LEN
+    const char* pName = pNames;
+    for (uint8_t phase = 0; phase < STATS_COUNT; phase++)
+    {
+      strcpy_P(pStr, pName);
+      pStr = Append(pStr + strlen(pStr), phases[phase].lastUS / 1000);
+      *pStr++ = ' ';
+      pName += strlen_P(pName) + 1;
+    }
+    strcpy(Append(pStr, lastBytes / 1024), "KB");
+  }
+
+  void Dump()
+  {
+    // min/max/mean of each phase to Serial
+#ifdef DEBUG
+    if (!slides)
+      return;
+    const char* pName = pNames;
+    for (uint8_t phase = 0; phase < STATS_COUNT; phase++)
+    {
+      const Phase& stats = phases[phase];
+      Serial.print(';');Serial.print((const __FlashStringHelper*)pName);
+      Serial.print(" min ");Serial.print(stats.minUS);
+      Serial.print("us, max ");Serial.print(stats.maxUS);
+      Serial.print("us, mean ");Serial.print((stats.totalMS + slides / 2) / slides); // rounded
+      Serial.println("ms");
+      pName += strlen_P(pName) + 1;
+    }
+    Serial.print(";");Serial.print(slides);
+    Serial.print(" slides, mean ");Serial.print((totalKB + slides / 2) / slides);
+    Serial.println("KB read");
+#endif
+  }
+};
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+
+// Where a slide's time goes, see CFG_STATS. The phases timed:
+#define STATS_SCAN    0 // finding the next slide (Slides::GetNext)
+#define STATS_OPEN    1 // opening its file
+#define STATS_HEADER  2 // reading its header
+#define STATS_NAME    3 // finding its caption (ExtractOriginalName)
+#define STATS_READ    4 // reading its rows (or its cached copy)
+#define STATS_LCD     5 // pushing its pixels to the LCD
+#define STATS_TITLE   6 // drawing its title
+#define STATS_COUNT   7
+#define STATS_FORMAT_LEN 96 // Format()'s longest string, with the '\0'
+
+#ifdef CFG_STATS
+// Times the code between STATS_START(phase) and STATS_STOP(phase), in one scope
+#define STATS_START(_phase) uint32_t _statsUS##_phase = micros();
+#define STATS_STOP(_phase) Stats::Add(_phase, micros() - _statsUS##_phase);
+#define STATS_BYTES(_n) Stats::slideBytes += (_n);
+#define STATS_SLIDE() Stats::EndSlide();
+#else
+#define STATS_START(_phase)
+#define STATS_STOP(_phase)
+#define STATS_BYTES(_n)
+#define STATS_SLIDE()
+#endif
+
+namespace Stats
+{
+  extern uint32_t slideBytes;
+  void Add(uint8_t phase, uint32_t us);
+  void EndSlide();
+  void Format(char* pStr);
+  void Dump();
+};
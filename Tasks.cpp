@@ -0,0 +1,55 @@
+#include <Arduino.h>
+#include "Config.h"
+#include "Tasks.h"
+
+// Tasks never preempt each other, so a long run (painting a slide) makes the others late.
+// That's what worstLateMS shows.
+namespace Tasks
+{
+  void RunDue(Task* pTasks, uint8_t count)
+  {
+    // one pass, running each task that's due
+    for (; count--; pTasks++)
+    {
+      uint32_t startMS = millis();
+      uint32_t lateMS = startMS - pTasks->dueMS;
+      if ((int32_t)lateMS < 0)
+        continue;
+      pTasks->pRun();
+      uint32_t runMS = millis() - startMS;
+      if (runMS > pTasks->budgetMS)
+        pTasks->overruns++;
+      if (runMS > pTasks->worstMS)
+        pTasks->worstMS = min<uint32_t>(runMS, 0xFFFF);
+      if (pTasks->periodMS && lateMS > pTasks->worstLateMS) // one run on every pass has no due time to be late for
+        pTasks->worstLateMS = min<uint32_t>(lateMS, 0xFFFF);
+      // keep to the period, unless a whole one was missed
+      pTasks->dueMS += pTasks->periodMS;
+      if (lateMS >= pTasks->periodMS)
+        pTasks->dueMS = startMS + pTasks->periodMS;
+    }
+  }
+
+  void Report(const Task* pTasks, uint8_t count)
+  {
+    // the stats to Serial
+#ifdef DEBUG
+    for (uint8_t task = 0; task < count; task++, pTasks++)
+    {
+      Serial.print(";task ");Serial.print(task);
+      Serial.print(": ");Serial.print(pTasks->overruns);
+      Serial.print(" overruns, worst ");Serial.print(pTasks->worstMS);
+      if (pTasks->periodMS)
+      {
+        Serial.print("ms, ");Serial.print(pTasks->worstLateMS);
+        Serial.println("ms late");
+      }
+      else
+        Serial.println("ms");
+    }
+#else
+    (void)pTasks;
+    (void)count;
+#endif
+  }
+};
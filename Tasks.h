@@ -0,0 +1,22 @@
+#pragma once
+
+// A run-to-completion scheduler. Each pass of RunDue() runs, in order, the tasks that are due
+#define TASK(_run, _periodMS, _budgetMS) { _run, _periodMS, _budgetMS, 0, 0, 0, 0 }
+
+namespace Tasks
+{
+  typedef void (*Run)();
+  struct Task
+  {
+    Run pRun;
+    uint16_t periodMS;    // 0 runs on every pass
+    uint16_t budgetMS;    // longer runs are counted as overruns
+    uint32_t dueMS;
+    uint16_t overruns;
+    uint16_t worstMS;     // longest run
+    uint16_t worstLateMS; // longest start after it was due (not for period 0)
+  };
+
+  void RunDue(Task* pTasks, uint8_t count);
+  void Report(const Task* pTasks, uint8_t count);
+};
@@ -0,0 +1,202 @@
+#include <Arduino.h>
+#include "Config.h"
+#include "LCD.h"
+#include "Transitions.h"
+
+// The effects read the rows of a BMP, stored bottom-up, so passes are painted bottom-up where
+// possible. Then reads move forward through the file and stay within the SD library's cached sector.
+namespace Transitions
+{
+  const uint8_t kBlindSize = 8;   // rows in a blind
+  const uint8_t kStripWidth = 32; // columns in a wipe strip, a multiple of 8
+  const uint8_t kBlockWidth = 32; // block size, width a multiple of 8
+  const uint8_t kBlockHeight = 16;
+
+  bool Replicating = false;
+  bool Stopped = false;
+
+  uint16_t GCD(uint16_t a, uint16_t b)
+  {
+    while (b)
+    {
+      uint16_t t = a % b;
+      a = b;
+      b = t;
+    }
+    return a;
+  }
+
+  // A full-period permutation of 0..n-1, for any n, without rejection:
+  // steps by a stride co-prime to n, near n/golden ratio, so the order is well spread.
+  struct Permutation
+  {
+    uint16_t n;
+    uint16_t stride;
+    uint16_t next;
+
+    Permutation(uint16_t _n) : n(_n)
+    {
+      stride = (uint32_t)n * 618 / 1000;
+      if (!stride)
+        stride = 1;
+      while (GCD(stride, n) != 1)
+        stride++;
+      next = random(n);
+    }
+
+    uint16_t Next()
+    {
+      uint16_t result = next;
+      next += stride;
+      if (next >= n)
+        next -= n;
+      return result;
+    }
+  };
+
+  uint8_t Pick()
+  {
+    // the transition for the next slide
+#if CFG_TRANSITION == TRANSITION_RANDOM
+    return random(TRANSITION_COUNT);
+#else
+    return CFG_TRANSITION;
+#endif
+  }
+
+  bool RowsOnly(uint8_t transition)
+  {
+    // true if the transition paints whole rows
+    return transition != TRANSITION_WIPE_RIGHT && transition != TRANSITION_BLOCKS;
+  }
+
+  void Block(uint16_t x, uint16_t y, uint16_t row, uint16_t col, uint16_t pixels, uint16_t rows, PaintSpan pPaint)
+  {
+    // paint rows of a block top-down in one window
+    if (Stopped)
+      return;
+    LCD_BEGIN_FILL(x + col, y + row, pixels, rows);
+    while (rows-- && !Stopped)
+      pPaint(row++, col, pixels);
+  }
+
+  void Pass(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t first, uint16_t step, PaintSpan pPaint)
+  {
+    // paint rows first, first + step, ... bottom-up
+    if (first >= h)
+      return;
+    uint16_t row = first + ((h - 1 - first) / step) * step;
+    while (!Stopped)
+    {
+      Block(x, y, row, 0, w, 1, pPaint);
+      if (row < first + step)
+        break;
+      row -= step;
+    }
+  }
+
+  void ProgressivePass(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t first, uint16_t step, uint16_t rows, PaintSpan pPaint)
+  {
+    // paint rows first, first + step, ... bottom-up, each repeated to fill rows
+    if (first >= h)
+      return;
+    uint16_t row = first + ((h - 1 - first) / step) * step;
+    while (!Stopped)
+    {
+      uint16_t copies = min<uint16_t>(rows, h - row);
+      LCD_BEGIN_FILL(x, y + row, w, copies);
+      pPaint(row, 0, w);
+      Replicating = true;
+      while (--copies && !Stopped) // re-read from the SD library's cached sector
+        pPaint(row, 0, w);
+      Replicating = false;
+      if (row < first + step)
+        break;
+      row -= step;
+    }
+  }
+
+  uint32_t Reveal(uint8_t transition, uint16_t x, uint16_t y, uint16_t w, uint16_t h, PaintSpan pPaint)
+  {
+    // reveal the w x h area at x, y using the transition
+    // returns the ms until the whole area showed something, if sooner than the end
+    uint32_t coverageMS = 0;
+    uint32_t startMS = millis();
+    Stopped = false;
+    switch (transition)
+    {
+      case TRANSITION_DISSOLVE:
+      {
+        Permutation rows(h);
+        for (uint16_t ctr = 0; ctr < h && !Stopped; ctr++)
+          Block(x, y, rows.Next(), 0, w, 1, pPaint);
+        break;
+      }
+      case TRANSITION_BLINDS:
+        for (uint8_t first = 0; first < kBlindSize && !Stopped; first++)
+          Pass(x, y, w, h, first, kBlindSize, pPaint);
+        break;
+      case TRANSITION_INTERLACE:
+        Pass(x, y, w, h, 0, 8, pPaint);
+        for (uint8_t step = 8; step > 1 && !Stopped; step >>= 1)
+          Pass(x, y, w, h, step / 2, step, pPaint);
+        break;
+      case TRANSITION_WIPE_UP:
+        Pass(x, y, w, h, 0, 1, pPaint);
+        break;
+      case TRANSITION_WIPE_RIGHT:
+        for (uint16_t col = 0; col < w && !Stopped; col += kStripWidth)
+          Block(x, y, 0, col, min<uint16_t>(kStripWidth, w - col), h, pPaint);
+        break;
+      case TRANSITION_BLOCKS:
+      {
+        // each pass sweeps up the bands, revealing one block in each, in a different order for each band
+        uint16_t across = (w + kBlockWidth - 1) / kBlockWidth;
+        uint16_t bands = (h + kBlockHeight - 1) / kBlockHeight;
+        Permutation cols(across);
+        for (uint16_t pass = 0; pass < across && !Stopped; pass++)
+        {
+          uint16_t col = cols.Next();
+          for (uint16_t band = bands; band-- && !Stopped;)
+          {
+            uint16_t block = (col + 5 * band) % across;
+            uint16_t row = band * kBlockHeight;
+            Block(x, y, row, block * kBlockWidth, 
+                  min<uint16_t>(kBlockWidth, w - block * kBlockWidth), min<uint16_t>(kBlockHeight, h - row), pPaint);
+          }
+        }
+        break;
+      }
+      case TRANSITION_PROGRESSIVE:
+        ProgressivePass(x, y, w, h, 0, 8, 8, pPaint);
+        coverageMS = millis() - startMS;
+        for (uint8_t step = 8; step > 1 && !Stopped; step >>= 1)
+          ProgressivePass(x, y, w, h, step / 2, step, step / 2, pPaint);
+        break;
+      default:
+        Block(x, y, 0, 0, w, h, pPaint);
+        break;
+    }
+    return coverageMS;
+  }
+
+  void Record(uint8_t transition, uint16_t sectors, uint32_t coverageMS, uint32_t ms)
+  {
+    // report the cost of the transition
+#ifdef DEBUG
+    Serial.print(";transition ");Serial.print(transition);
+    Serial.print(": ");Serial.print(sectors);
+    Serial.print(" sectors, ");
+    if (coverageMS)
+    {
+      Serial.print(coverageMS);Serial.print("ms to cover, ");
+    }
+    Serial.print(ms);Serial.println("ms");
+#else
+    (void)transition;
+    (void)sectors;
+    (void)coverageMS;
+    (void)ms;
+#endif
+  }
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+// Ways of revealing a slide. See CFG_TRANSITION
+#define TRANSITION_NONE         0 // top-down
+#define TRANSITION_DISSOLVE     1 // rows in pseudo-random order
+#define TRANSITION_BLINDS       2 // venetian blinds, opening downwards
+#define TRANSITION_INTERLACE    3 // every 8th row, then the 4th, 2nd and the rest
+#define TRANSITION_WIPE_UP      4 // bottom-up
+#define TRANSITION_WIPE_RIGHT   5 // left to right, in vertical strips
+#define TRANSITION_BLOCKS       6 // blocks in pseudo-random order
+#define TRANSITION_PROGRESSIVE  7 // every 8th row as a block, then refined by the 4th, 2nd and the rest
+#define TRANSITION_COUNT        8
+#define TRANSITION_RANDOM       0xFF // a different one for each slide
+
+namespace Transitions
+{
+  // Paints pixels [col, col + pixels) of row into the current LCD window.
+  // col is always a multiple of 8.
+  typedef void (*PaintSpan)(uint16_t row, uint16_t col, uint16_t pixels);
+  // True while PaintSpan is repeating a row to fill the rows below it
+  extern bool Replicating;
+  // Set by PaintSpan to end the reveal, nothing more is painted (or windows opened)
+  extern bool Stopped;
+
+  uint8_t Pick();
+  bool RowsOnly(uint8_t transition);
+  uint32_t Reveal(uint8_t transition, uint16_t x, uint16_t y, uint16_t w, uint16_t h, PaintSpan pPaint);
+  void Record(uint8_t transition, uint16_t sectors, uint32_t coverageMS, uint32_t ms);
+};
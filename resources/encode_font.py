@@ -1,114 +1,146 @@
-#!/usr/bin/python
-import os
-import sys
-
-# encode characters from .bdf file
-# not row-compressed, cf encode_windows
-
-# The <command> char isn't in the file, but is nice to have!
-extras = """
-  // (not in font file)
-  129,  // <command>
-  0xA9, 0x00,
-  0b0110001, 0b10000000,
-  0b1001010, 0b01000000,
-  0b1001010, 0b01000000,
-  0b0111111, 0b10000000,
-  0b0001010, 0b00000000,
-  0b0111111, 0b10000000,
-  0b1001010, 0b01000000,
-  0b1001010, 0b01000000,
-  0b0110001, 0b10000000,
-"""
-
-def DataStr(hex):
-    # hex is nn or nnnn, return a 1 or 2 byte string
-    if len(hex) == 2:
-        return "0x" + hex + ", "
-    else:
-        return DataStr(hex[:2]) + DataStr(hex[2:])
-
-def ByteStr(b):
-    return "0x" + hex(256 + b)[3:].upper()
-    
-def UPack(a, b):
-    # 0baaaabbbb
-    return ByteStr(((a % 16) << 4) + (b % 16))
-
-def SPack(a, b):
-    # 0bsaaasbbb s is the sign, 1=-ve
-    neg = a < 0
-    a = abs(a) % 8
-    if neg:
-        a += 8
-        
-    neg = b < 0
-    b = abs(b) % 8
-    if neg:
-        b += 8
-    return UPack(a, b)
-    
-bdf = open("Chicago-12.bdf", "r")
-lines = bdf.readlines()
-file = open("FontData.h", "w")
-file.write("// (created from \"" + bdf.name + "\" by " + os.path.basename(__file__) + ")\n")
-line = 0
-count = 1
-file.write("#define FONT_HEIGHT    12\n")
-file.write("#define FONT_DESCENDER  3\n")
-file.write("static const uint8_t Font[] PROGMEM =\n{\n")
-file.write("  // char\n")
-#file.write("  // w, h, dx, dy\n")
-file.write("  // (w, h):0bwwwwhhhh, (dx, dy):0bsxxxsyyy s:sign, 1=-ve\n")
-file.write("  // 1BPP row data...\n")
-while not lines[line].startswith("ENDFONT"):
-    while not lines[line].startswith("ENCODING"):
-        line += 1
-    if lines[line].startswith("ENCODING"):
-        ch = int(lines[line].split(" ")[1])
-        line += 1
-        if (32 < ch and ch < 127) or ch == 63743 or ch == 8226:
-            # process char
-            if ch == 8226:  # bullet
-                ch = 127
-                file.write("\n")
-            if ch == 63743: # apple
-                ch = 128
-            line += 2
-            # BBX
-            BBX = lines[line].split(" ")
-            w = int(BBX[1])
-            h = int(BBX[2])
-            dx = int(BBX[3])
-            dy = int(BBX[4])
-            #sys.stdout.write(str(ch) + " " + str(BBX) + "\n") 
-            file.write("  " + str(ch) + ",")
-            if ch == 127:
-                file.write("  // <bullet>")
-            elif ch == 128:
-                file.write("  // <apple>")
-            elif ch != '\\' and ch != '/':
-                file.write("  // '" + str(chr(ch)) + "'")
-            file.write("\n")
-            #file.write("  " + str(w) + ", " + str(h) + ", " + str(dx) + ", " + str(dy) + ",\n") # todo back as 0xWH, 0xSxxxSyyyy
-            file.write("  " + UPack(w, h) + ", " + SPack(dx, dy) + ",\n") # todo back as 0xWH, 0xSxxxSyyyy
-            #count += 5
-            count += 3
-            count += h if w <= 8 else 2*h
-            line += 2
-            file.write("  ")
-            while not lines[line].startswith("ENDCHAR"):
-                file.write(DataStr(lines[line].strip()))
-                line += 1
-            file.write("\n")
-        else:
-            while not lines[line].startswith("ENDCHAR"):
-                line += 1
-        line += 1
-file.write(extras)
-count += extras.count(",")  
-file.write("  0\n")
-file.write("}; // " + str(count) + " bytes\n\n")
-file.close()
-bdf.close()
-sys.stdout.write("Created " + file.name + "\n\n")
+#!/usr/bin/python
+import os
+import sys
+
+# encode characters from .bdf file
+# not row-compressed, cf encode_windows
+
+# The <command> char isn't in the file, but is nice to have!
+extras = """
+  // (not in font file)
+  129,  // <command>
+  0xA9, 0x00,
+  0b0110001, 0b10000000,
+  0b1001010, 0b01000000,
+  0b1001010, 0b01000000,
+  0b0111111, 0b10000000,
+  0b0001010, 0b00000000,
+  0b0111111, 0b10000000,
+  0b1001010, 0b01000000,
+  0b1001010, 0b01000000,
+  0b0110001, 0b10000000,
+"""
+
+def DataStr(hex):
+    # hex is nn or nnnn, return a 1 or 2 byte string
+    if len(hex) == 2:
+        return "0x" + hex + ", "
+    else:
+        return DataStr(hex[:2]) + DataStr(hex[2:])
+
+def ByteStr(b):
+    return "0x" + hex(256 + b)[3:].upper()
+    
+def UPack(a, b):
+    # 0baaaabbbb
+    return ByteStr(((a % 16) << 4) + (b % 16))
+
+def SPack(a, b):
+    # 0bsaaasbbb s is the sign, 1=-ve
+    neg = a < 0
+    a = abs(a) % 8
+    if neg:
+        a += 8
+        
+    neg = b < 0
+    b = abs(b) % 8
+    if neg:
+        b += 8
+    return UPack(a, b)
+    
+# the index: FIRST_CHAR..LAST_CHAR, the offset of each char's (w, h) byte in Font and its advance width
+FIRST_CHAR = 32
+LAST_CHAR = 129
+SPACE_ADVANCE = 4
+NO_GLYPH = 0xFFFF
+offsets = {}
+advances = {FIRST_CHAR: SPACE_ADVANCE}
+offsets[129] = None # <command>, in extras
+advances[129] = 0xA + 0 + 1
+
+bdf = open("Chicago-12.bdf", "r")
+lines = bdf.readlines()
+file = open("FontData.h", "w")
+file.write("// (created from \"" + bdf.name + "\" by " + os.path.basename(__file__) + ")\n")
+line = 0
+count = 1
+file.write("#define FONT_HEIGHT    12\n")
+file.write("#define FONT_DESCENDER  3\n")
+file.write("static const uint8_t Font[] PROGMEM =\n{\n")
+file.write("  // char\n")
+#file.write("  // w, h, dx, dy\n")
+file.write("  // (w, h):0bwwwwhhhh, (dx, dy):0bsxxxsyyy s:sign, 1=-ve\n")
+file.write("  // 1BPP row data...\n")
+while not lines[line].startswith("ENDFONT"):
+    while not lines[line].startswith("ENCODING"):
+        line += 1
+    if lines[line].startswith("ENCODING"):
+        ch = int(lines[line].split(" ")[1])
+        line += 1
+        if (32 < ch and ch < 127) or ch == 63743 or ch == 8226:
+            # process char
+            if ch == 8226:  # bullet
+                ch = 127
+                file.write("\n")
+            if ch == 63743: # apple
+                ch = 128
+            line += 2
+            # BBX
+            BBX = lines[line].split(" ")
+            w = int(BBX[1])
+            h = int(BBX[2])
+            dx = int(BBX[3])
+            dy = int(BBX[4])
+            #sys.stdout.write(str(ch) + " " + str(BBX) + "\n") 
+            file.write("  " + str(ch) + ",")
+            if ch == 127:
+                file.write("  // <bullet>")
+            elif ch == 128:
+                file.write("  // <apple>")
+            elif ch != '\\' and ch != '/':
+                file.write("  // '" + str(chr(ch)) + "'")
+            file.write("\n")
+            #file.write("  " + str(w) + ", " + str(h) + ", " + str(dx) + ", " + str(dy) + ",\n") # todo back as 0xWH, 0xSxxxSyyyy
+            file.write("  " + UPack(w, h) + ", " + SPack(dx, dy) + ",\n") # todo back as 0xWH, 0xSxxxSyyyy
+            offsets[ch] = count  # (count includes the char byte)
+            advances[ch] = dx + w + 1
+            #count += 5
+            count += 3
+            count += h if w <= 8 else 2*h
+            line += 2
+            file.write("  ")
+            while not lines[line].startswith("ENDCHAR"):
+                file.write(DataStr(lines[line].strip()))
+                line += 1
+            file.write("\n")
+        else:
+            while not lines[line].startswith("ENDCHAR"):
+                line += 1
+        line += 1
+offsets[129] = count
+file.write(extras)
+count += extras.count(",")  
+file.write("  0\n")
+file.write("}; // " + str(count) + " bytes\n\n")
+
+# the index, so a char is found (or measured) without walking Font
+file.write("#define FONT_FIRST_CHAR " + str(FIRST_CHAR) + "\n")
+file.write("#define FONT_LAST_CHAR  " + str(LAST_CHAR) + "\n")
+file.write("#define FONT_NO_GLYPH   " + hex(NO_GLYPH).upper().replace("X", "x") + "\n")
+file.write("// offset of each char's (w, h) byte in Font, FONT_NO_GLYPH if it has none\n")
+file.write("static const uint16_t FontOffsets[] PROGMEM =\n{")
+for ch in range(FIRST_CHAR, LAST_CHAR + 1):
+    if (ch - FIRST_CHAR) % 8 == 0:
+        file.write("\n  ")
+    file.write(str(offsets.get(ch, NO_GLYPH)) + ", ")
+file.write("\n}; // " + str(2*(LAST_CHAR - FIRST_CHAR + 1)) + " bytes\n\n")
+file.write("// advance width of each char, dx + w + 1\n")
+file.write("static const uint8_t FontAdvances[] PROGMEM =\n{")
+for ch in range(FIRST_CHAR, LAST_CHAR + 1):
+    if (ch - FIRST_CHAR) % 16 == 0:
+        file.write("\n  ")
+    file.write(str(advances.get(ch, 0)) + ", ")
+file.write("\n}; // " + str(LAST_CHAR - FIRST_CHAR + 1) + " bytes\n\n")
+file.close()
+bdf.close()
+sys.stdout.write("Created " + file.name + "\n\n")
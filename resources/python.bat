@@ -1 +1 @@
-"C:\Program Files\Inkscape\python" %1 %2 %3
+"C:\Program Files\Inkscape\python" %1 %2 %3
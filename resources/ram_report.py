@@ -0,0 +1,62 @@
+#!/usr/bin/python3
+import os
+import sys
+import argparse
+import subprocess
+
+# where the Uno's 2K of RAM goes: the globals (.data and .bss) of a built sketch by module, and what's left
+# for the heap and stack. See Memory.h for what the stack actually reaches (reported to Serial with DEBUG)
+#   python3 ram_report.py path/to/LackPaint.ino.elf
+# the .elf is in the Arduino IDE's build folder (File > Preferences > "Show verbose output during compilation" shows it)
+
+RAM_SIZE = 2048
+RAM_TYPES = 'bBdD'
+
+def Symbols(nm, elf):
+    # (size, type, name, file) of each global in RAM
+    out = subprocess.check_output([nm, '-C', '-S', '-l', elf]).decode('ascii', 'replace')
+    symbols = []
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) < 4 or parts[2] not in RAM_TYPES:
+            continue
+        name, _, where = parts[3].partition('\t')
+        symbols.append((int(parts[1], 16), parts[2], name, where.rsplit(':', 1)[0]))
+    return symbols
+
+def Module(name, where):
+    # the library or core a global's from, else its source file, else its namespace or name
+    parts = where.replace('\\', '/').split('/')
+    for folder in ('libraries', 'cores'):
+        if folder in parts[:-1]:
+            return parts[parts.index(folder) + 1]
+    if where:
+        return parts[-1]
+    if '::' in name:
+        return name.split('::')[0]
+    return '(' + name + ')'
+
+def main():
+    parser = argparse.ArgumentParser(description = 'Report the RAM used by a built sketch')
+    parser.add_argument('elf', help = 'the built sketch')
+    parser.add_argument('--nm', default = 'avr-nm', help = 'avr-nm to use, eg from the Arduino IDE\'s tools')
+    parser.add_argument('--symbols', action = 'store_true', help = 'list each global')
+    args = parser.parse_args()
+
+    modules = {}
+    symbols = Symbols(args.nm, args.elf)
+    for size, type, name, where in symbols:
+        modules.setdefault(Module(name, where), []).append((size, name))
+    total = 0
+    for module, entries in sorted(modules.items(), key = lambda m: -sum(size for size, name in m[1])):
+        size = sum(size for size, name in entries)
+        total += size
+        print('%5d  %s' % (size, module))
+        if args.symbols:
+            for size, name in sorted(entries, reverse = True):
+                print('         %5d  %s' % (size, name))
+    print('%5d  globals' % total)
+    print('%5d  left for the heap and stack, of %d' % (RAM_SIZE - total, RAM_SIZE))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,261 @@
+#!/usr/bin/python3
+import os
+import sys
+import time
+import argparse
+import threading
+
+# stream a folder of slides (BMPs, as made by make_slides.bat) to LackPaint over Serial, see CFG_SERIAL_INGEST
+# the protocol is in Ingest.h
+# Linux only (uses termios and, for --simulate, a pty)
+#   python3 stream_slides.py /dev/ttyACM0 slides_folder
+#   python3 stream_slides.py --simulate out_folder slides_folder     (no Uno, writes what it received as .pgm files)
+
+SYNC = b'LP'
+MAX_PAYLOAD = 56
+HELLO, START, RUNS, END = b'H', b'S', b'R', b'E'
+READY, ACK, NAK = b'R', b'+', b'!'
+CREDIT = 64
+CREDIT_STEP = 32
+WINDOW_W, WINDOW_H = 396, 218
+
+def Frame(type, payload = b''):
+    # a frame of type with payload
+    check = (type[0] + len(payload) + sum(payload)) & 0xFF
+    return SYNC + type + bytes([len(payload)]) + payload + bytes([check])
+
+def AppendedName(data):
+    # the name appended by make_slides.bat, "NAME:=\r\n<name>\r\n", or None
+    idx = data.rfind(b'NAME:=\r\n')
+    if idx < 0:
+        return None
+    return data[idx + 8:].split(b'\r')[0].decode('ascii', 'replace')
+
+def ReadBMP(path):
+    # return (width, height, rows of grey levels 0..15, top-down) of an uncompressed 1 or 4bpp BMP, or None
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:2] != b'BM':
+        return None
+    dword = lambda o: int.from_bytes(data[o:o + 4], 'little')
+    offset, width, height, bpp, compression = dword(0x0A), dword(0x12), dword(0x16), dword(0x1C) & 0xFFFF, dword(0x1E)
+    if bpp not in (1, 4) or compression != 0 or not width or not height or height >= 0x80000000:
+        return None
+    rowSize = ((bpp*width + 31)//32)*4
+    rows = []
+    for r in range(height):
+        row = data[offset + (height - 1 - r)*rowSize:][:rowSize]
+        if bpp == 1:
+            rows.append([15 if row[c//8] & (0x80 >> (c % 8)) else 0 for c in range(width)])
+        else:
+            rows.append([(row[c//2] >> 4) if c % 2 == 0 else (row[c//2] & 0x0F) for c in range(width)])
+    return width, height, rows
+
+def Crop(width, height, rows):
+    # centre-crop to fit the window, the device needs it to fit
+    left = max(0, (width - WINDOW_W)//2)
+    top = max(0, (height - WINDOW_H)//2)
+    width, height = min(width, WINDOW_W), min(height, WINDOW_H)
+    return width, height, [row[left:left + width] for row in rows[top:top + height]]
+
+def EncodeRuns(rows):
+    # runs of <level:4,count:4> bytes, count 0 means the count is in the next byte
+    pixels = [p for row in rows for p in row]
+    runs = bytearray()
+    idx = 0
+    while idx < len(pixels):
+        level = pixels[idx]
+        count = 1
+        while idx + count < len(pixels) and pixels[idx + count] == level and count < 255:
+            count += 1
+        if count <= 0x0F:
+            runs.append((level << 4) | count)
+        else:
+            runs += bytes([level << 4, count])
+        idx += count
+    return bytes(runs)
+
+def SlideParts(name, width, height, rows):
+    # the START frame, the runs and the END frame for a slide
+    start = Frame(START, width.to_bytes(2, 'little') + height.to_bytes(2, 'little') + name.encode('ascii', 'replace')[:40])
+    return start, EncodeRuns(rows), Frame(END)
+
+class Port:
+    # a raw serial port (or pty)
+    def __init__(self, path, baud):
+        import termios, tty
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        attrs = termios.tcgetattr(self.fd)
+        speed = getattr(termios, 'B%d' % baud)
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+
+    def write(self, data):
+        while data:
+            data = data[os.write(self.fd, data):]
+
+    def read(self, timeout):
+        # whatever has arrived within timeout seconds
+        import select
+        if select.select([self.fd], [], [], timeout)[0]:
+            return os.read(self.fd, 256)
+        return b''
+
+class Sender:
+    # sends frames within the device's credit
+    def __init__(self, port):
+        self.port = port
+        self.credit = 0
+        self.nak = False
+        self.ready = False
+
+    def Replies(self, timeout):
+        # act on the device's replies
+        for ch in self.port.read(timeout):
+            ch = bytes([ch])
+            if ch == ACK:
+                self.credit += CREDIT_STEP
+            elif ch == NAK:
+                self.nak = True
+            elif ch == READY:
+                self.credit = CREDIT
+                self.ready = True
+
+    def Hello(self):
+        # (re)start, the Uno resets when the port opens so keep trying
+        while True:
+            self.credit = 0
+            self.port.write(Frame(HELLO))
+            deadline = time.time() + 1.0
+            while time.time() < deadline and not self.credit:
+                self.Replies(0.1)
+            if self.credit:
+                return
+
+    def WaitFor(self, n, ready = False, timeout = 3.0):
+        # wait until there's credit for n bytes (or with ready, for READY)
+        # False if the device NAKed or went quiet (it gives up on a slide after 2s)
+        deadline = time.time() + timeout
+        while (not self.ready) if ready else (self.credit < n):
+            if self.nak or time.time() > deadline:
+                return False
+            self.Replies(0.1)
+        return not self.nak
+
+    def Put(self, frame):
+        # send a frame, the credit has been checked
+        self.port.write(frame)
+        self.credit -= len(frame)
+
+    def Send(self, parts):
+        # send a slide's parts, the runs in frames sized to the credit there is. False if the device NAKed or went quiet
+        # (everything sent is acknowledged but the last < CREDIT_STEP bytes, so there's always room for a frame,
+        # and the device answers END with READY, so a slide starts with full credit)
+        start, runs, end = parts
+        self.nak = False
+        if not self.WaitFor(len(start)):
+            return False
+        self.Put(start)
+        while runs:
+            if not self.WaitFor(6):
+                return False
+            n = min(MAX_PAYLOAD, self.credit - 5, len(runs))
+            self.Put(Frame(RUNS, runs[:n]))
+            runs = runs[n:]
+        if not self.WaitFor(len(end)):
+            return False
+        self.ready = False
+        self.Put(end)
+        return self.WaitFor(0, ready = True)
+
+def Simulate(fd, outFolder):
+    # a device on the other end of a pty: acks, checks and writes each slide received as a .pgm
+    import tty
+    tty.setraw(fd)
+    unacked, buffer, slide = 0, b'', None
+    while True:
+        data = os.read(fd, 256)
+        for b in data:
+            unacked += 1
+            if unacked == CREDIT_STEP:
+                os.write(fd, ACK)
+                unacked = 0
+        buffer += data
+        while True:
+            start = buffer.find(SYNC)
+            if start < 0 or len(buffer) < start + 4:
+                break
+            length = buffer[start + 3]
+            if len(buffer) < start + 5 + length:
+                break
+            type, payload, check = buffer[start + 2:start + 3], buffer[start + 4:start + 4 + length], buffer[start + 4 + length]
+            buffer = buffer[start + 5 + length:]
+            if (type[0] + length + sum(payload)) & 0xFF != check:
+                os.write(fd, NAK)
+            elif type == HELLO:
+                unacked = 0
+                os.write(fd, READY)
+            elif type == START:
+                w, h = int.from_bytes(payload[0:2], 'little'), int.from_bytes(payload[2:4], 'little')
+                slide = [w, h, payload[4:].decode('ascii'), bytearray(), None]
+            elif type == RUNS and slide:
+                for b in payload:
+                    if slide[4] is not None:
+                        slide[3] += bytes([slide[4]*17])*b
+                        slide[4] = None
+                    elif b & 0x0F:
+                        slide[3] += bytes([(b >> 4)*17])*(b & 0x0F)
+                    else:
+                        slide[4] = b >> 4
+            elif type == END:
+                unacked = 0
+                os.write(fd, READY)
+                if slide:
+                    w, h, name, pixels = slide[:4]
+                    print('  received %s %dx%d, %d pixels%s' % (name, w, h, len(pixels), '' if len(pixels) == w*h else ' *** WRONG ***'))
+                    with open(os.path.join(outFolder, name + '.pgm'), 'wb') as f:
+                        f.write(b'P5 %d %d 255\n' % (w, h) + bytes(pixels[:w*h]))
+                    slide = None
+
+def main():
+    parser = argparse.ArgumentParser(description = 'Stream slides to LackPaint over Serial')
+    parser.add_argument('port', help = 'serial port, eg /dev/ttyACM0, or with --simulate, a folder for what is received')
+    parser.add_argument('folder', help = 'folder of BMP slides')
+    parser.add_argument('--baud', type = int, default = 115200, help = 'see CFG_SERIAL_INGEST')
+    parser.add_argument('--seconds', type = float, default = 10, help = 'between slides')
+    parser.add_argument('--loop', action = 'store_true', help = 'repeat forever')
+    parser.add_argument('--simulate', action = 'store_true', help = 'send to a simulated device on a pty')
+    args = parser.parse_args()
+
+    path = args.port
+    if args.simulate:
+        import pty
+        master, slave = pty.openpty()
+        threading.Thread(target = Simulate, args = (master, args.port), daemon = True).start()
+        path = os.ttyname(slave)
+        args.seconds = 0
+    sender = Sender(Port(path, args.baud))
+    sender.Hello()
+    while True:
+        for file in sorted(os.listdir(args.folder)):
+            bmp = ReadBMP(os.path.join(args.folder, file)) if file.upper().endswith('.BMP') else None
+            if not bmp:
+                continue
+            with open(os.path.join(args.folder, file), 'rb') as f:
+                name = AppendedName(f.read()) or os.path.splitext(file)[0]
+            parts = SlideParts(name, *Crop(*bmp))
+            print('%s, %d bytes of runs' % (file, len(parts[1])))
+            started = time.time()
+            while not sender.Send(parts):
+                print('  restarting')
+                sender.Hello()
+            print('  %.1fs' % (time.time() - started))
+            time.sleep(args.seconds)
+        if not args.loop:
+            break
+    if args.simulate:
+        time.sleep(0.5) # let the last slide arrive
+
+if __name__ == '__main__':
+    main()